@@ -3,6 +3,38 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <iterator>
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <optional>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <cerrno>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 
 
@@ -25,7 +57,11 @@ namespace DSA {
 
     //List<T> class definition
     template<typename T> class List final {
-        private: 
+        public:
+            class Pool;
+
+
+        private:
             //inner Node<T> class defined as private to avoid external access
             class Node final {
                 private:
@@ -35,33 +71,144 @@ namespace DSA {
                 public:
                     Node* next;
                     Node* prev;
-                
+
 
                     T& getValue(void) noexcept;
-                    void setValue(T);
+                    void setValue(const T&);
+                    void setValue(T&&);
 
 
 
-                    Node(T);
+                    template<typename... Args> Node(Args&&...);
             };
 
             Node* head;
             int length;
+            std::shared_ptr<Pool> pool;
+
+            //last node reached by an indexed access, it makes sequential indexed loops linear
+            Node* cursor;
+            int cursorIndex;
+
+
+            void linkBefore(Node*, Node*) noexcept;
+            void unlink(Node*) noexcept;
+            Node* nodeAt(int);
+            template<typename... Args> Node* createNode(Args&&...);
+            template<typename... Args> void emplaceAt(int, Args&&...);
+            void destroyNode(Node*) noexcept;
 
 
 
         public:
-            void add(T);
-            void add(T, int);
+            //slab allocator that recycles the memory of the nodes, it can be shared between lists
+            //of the same type so that splicing between them never reallocates a node
+            class Pool final {
+                private:
+                    union Slot {
+                        Slot* next;
+                        alignas(Node) unsigned char storage[sizeof(Node)];
+                    };
+
+
+                    std::vector<Slot*> slabs;
+                    Slot* freeSlots;
+                    std::size_t slabSize;
+                    std::size_t currentSlab;
+                    std::size_t usedSlots;
+
+
+                public:
+                    void* allocate(void);
+                    void deallocate(void*) noexcept;
+                    void reset(void) noexcept;
+                    std::size_t getCapacity(void) const noexcept;
+
+
+                    Pool(const Pool&) = delete;
+                    Pool& operator=(const Pool&) = delete;
+
+                    explicit Pool(std::size_t = 64);
+                    ~Pool(void);
+            };
+
+
+            //bidirectional iterator over the list, the end() iterator is represented by a null node
+            class Iterator final {
+                private:
+                    Node* node;
+                    const List<T>* list;
+
+
+                    Iterator(Node*, const List<T>*) noexcept;
+
+                    friend class List<T>;
+
+
+                public:
+                    using iterator_category = std::bidirectional_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = T*;
+                    using reference = T&;
+
+
+                    T& operator*(void) const noexcept;
+                    T* operator->(void) const noexcept;
+                    Iterator& operator++(void) noexcept;
+                    Iterator operator++(int) noexcept;
+                    Iterator& operator--(void) noexcept;
+                    Iterator operator--(int) noexcept;
+                    bool operator==(const Iterator&) const noexcept;
+                    bool operator!=(const Iterator&) const noexcept;
+
+
+                    Iterator(void) noexcept;
+            };
+
+
+            void add(const T&);
+            void add(T&&);
+            void add(const T&, int);
+            void add(T&&, int);
             void remove(void);
             void remove(int);
+            void pushBack(const T&);
+            void pushBack(T&&);
+            void pushFront(const T&);
+            void pushFront(T&&);
+            template<typename... Args> T& emplaceBack(Args&&...);
+            template<typename... Args> T& emplaceFront(Args&&...);
+            void popBack(void);
+            void popFront(void);
+            T& front(void);
+            T& back(void);
             T& operator[](int);
+            Iterator begin(void) noexcept;
+            Iterator end(void) noexcept;
+            Iterator insert(Iterator, const T&);
+            Iterator insert(Iterator, T&&);
+            template<typename... Args> Iterator emplace(Iterator, Args&&...);
+            Iterator erase(Iterator);
+            void splice(Iterator, List<T>&);
+            void splice(Iterator, List<T>&, Iterator);
+            void clear(void) noexcept;
+            void swap(List<T>&) noexcept;
+            List<T> clone(void) const;
             int getLength(void) const noexcept;
+            std::shared_ptr<Pool> getPool(void) const noexcept;
             std::string toString(void);
             std::string toString(Modality::Verse);
-            
+
+
+            List<T>& operator=(const List<T>&);
+            List<T>& operator=(List<T>&&) noexcept;
 
             List(void);
+            explicit List(std::shared_ptr<Pool>);
+            List(const List<T>&);
+            List(const List<T>&, std::shared_ptr<Pool>);
+            List(List<T>&&) noexcept;
             ~List(void);
     };
 
@@ -78,19 +225,72 @@ namespace DSA {
     template<typename T> List<T>::List() {
         this->head = nullptr;
         this->length = 0;
+        this->cursor = nullptr;
+        this->cursorIndex = 0;
+    }
+
+    //CONSTRUCTOR
+    //the list allocates its nodes from a pool that can be shared with other lists
+    template<typename T> List<T>::List(std::shared_ptr<Pool> pool): pool(pool) {
+        this->head = nullptr;
+        this->length = 0;
+        this->cursor = nullptr;
+        this->cursorIndex = 0;
+    }
+
+    //COPY CONSTRUCTOR
+    //copies the values in a single pass into a pool with a slab big enough to hold all of them
+    template<typename T> List<T>::List(const List<T>& other): List(other, other.head ? std::make_shared<Pool>(std::max<std::size_t>(other.length, 64)) : nullptr) {}
+
+    //COPY CONSTRUCTOR
+    //copies the values in a single pass allocating the nodes from the specified pool
+    template<typename T> List<T>::List(const List<T>& other, std::shared_ptr<Pool> pool): List(pool) {
+        Node* node = other.head;
+
+        for(int i = 0; i < other.length; i++) {
+            linkBefore(nullptr, createNode(node->getValue()));
+            node = node->next;
+        }
+    }
+
+    //MOVE CONSTRUCTOR
+    //takes the nodes and the pool of the other list, leaving it empty
+    template<typename T> List<T>::List(List<T>&& other) noexcept: List() {
+        swap(other);
     }
 
     //DESTRUCTOR
     template<typename T> List<T>::~List() {
-        while(length > 0) remove();
+        clear();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename T> List<T>& List<T>::operator=(const List<T>& other) {
+        if(this != &other) {
+            List<T> copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T> List<T>& List<T>::operator=(List<T>&& other) noexcept {
+        if(this != &other) {
+            clear();
+            swap(other);
+        }
+
+        return *this;
     }
 
 
     //METHODS
-    //inserts a node at the end of the list
-    template<typename T> void List<T>::add(T value) {
+    //links a detached node before position, a null position means after the tail.
+    //the node becomes the new head only when position is the head
+    template<typename T> void List<T>::linkBefore(Node* position, Node* node) noexcept {
         if(!head) {
-            head = new Node(value);
+            head = node;
             head->next = head;
             head->prev = head;
 
@@ -99,80 +299,236 @@ namespace DSA {
         }
 
 
-        Node* node = head;
-        for(int i = 0; i < length - 1; i++) node = node->next;
-        
-        
-        node->next = new Node(value);
-        node->next->prev = node;
-        node->next->next = head;
-        head->prev = node->next;
+        Node* next = position ? position : head;
+
+        node->next = next;
+        node->prev = next->prev;
+        next->prev->next = node;
+        next->prev = node;
+
+        //appending keeps the cursor index valid, inserting in front shifts it by one
+        if(position == head) {
+            head = node;
+            cursorIndex++;
+        }
+        else if(position) {
+            cursor = nullptr;
+        }
 
         length++;
     }
 
-    //inserts a node at an index in the list
-    template<typename T> void List<T>::add(T value, int index) {
-        if(!head) {
-            head = new Node(value);
-            head->next = head;
-            head->prev = head;
+    //detaches a node from the list without deleting it
+    template<typename T> void List<T>::unlink(Node* node) noexcept {
+        bool isHead = (node == head);
+        bool isTail = (node == head->prev);
 
-            length++;
-            return;
+
+        if(length == 1) {
+            head = nullptr;
         }
+        else {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
 
-        if (index == 0) {
-            insertIndexIsEqualToZero:
+            if(isHead) head = node->next;
+        }
 
-            Node* t = head->prev;
-            head->prev = new Node(value);
-            t->next = head->prev;
-            head->prev->next = head;
-            head->prev->prev = t;
-            head = head->prev;
 
+        //removing the tail keeps the cursor index valid, removing the head shifts it by one
+        if(node == cursor || (!isHead && !isTail)) cursor = nullptr;
+        else if(isHead) cursorIndex--;
 
-            length++;
-            return;
+
+        node->next = nullptr;
+        node->prev = nullptr;
+        length--;
+    }
+
+    //returns the node at an index, indexes wrap around the list in both directions.
+    //the walk starts from the nearest among the head, the tail and the cursor left by the previous access
+    template<typename T> typename List<T>::Node* List<T>::nodeAt(int index) {
+        if(!head) throw std::runtime_error("The List<T> is empty!");
+
+
+        index %= length;
+        if(index < 0) index += length;
+
+
+        Node* node = head;
+        int distance = index;
+
+        if(length - 1 - index < distance) {
+            node = head->prev;
+            distance = index - (length - 1);
         }
 
-        if(index == length) {
-            this->add(value);
-            return;
+        if(cursor && std::abs(index - cursorIndex) < std::abs(distance)) {
+            node = cursor;
+            distance = index - cursorIndex;
         }
 
 
-        Node* parent = head;
+        for(; distance > 0; distance--) node = node->next;
+        for(; distance < 0; distance++) node = node->prev;
 
 
-        if(index > 0) {
-            for(int i = 0; i < index - 1; i++) parent = parent->next;
+        cursor = node;
+        cursorIndex = index;
 
-            if(parent->next == head) goto insertIndexIsEqualToZero;
+        return node;
+    }
+
+    //constructs a node inside a slot of the pool, the pool is created on the first insertion
+    template<typename T> template<typename... Args> typename List<T>::Node* List<T>::createNode(Args&&... args) {
+        if(!pool) pool = std::make_shared<Pool>();
+
+        void* slot = pool->allocate();
+
+        try {
+            return new (slot) Node(std::forward<Args>(args)...);
+        }
+        catch(...) {
+            pool->deallocate(slot);
+            throw;
+        }
+    }
+
+    //destroys a detached node and gives its slot back to the pool
+    template<typename T> void List<T>::destroyNode(Node* node) noexcept {
+        node->~Node();
+        pool->deallocate(node);
+    }
+
+    //removes every element of the list.
+    //when the pool is owned only by this list and the values need no destructor the slabs are
+    //handed back all at once without walking the nodes
+    template<typename T> void List<T>::clear() noexcept {
+        if(!head) return;
 
 
+        if(pool.use_count() == 1) {
+            if(!std::is_trivially_destructible<T>::value) {
+                Node* node = head;
+
+                for(int i = 0; i < length; i++) {
+                    Node* next = node->next;
+                    node->~Node();
+                    node = next;
+                }
+            }
 
-            Node* t = parent->next;
-            parent->next = new Node(value);
-            parent->next->prev = parent;
-            parent->next->next = t;
-            t->prev = parent->next;
+            pool->reset();
         }
         else {
-            for(int i = 0; i > index + 1; i--) parent = parent->prev;
+            Node* node = head;
+
+            for(int i = 0; i < length; i++) {
+                Node* next = node->next;
+                destroyNode(node);
+                node = next;
+            }
+        }
+
+
+        head = nullptr;
+        length = 0;
+        cursor = nullptr;
+    }
+
+    //exchanges the content of two lists in constant time
+    template<typename T> void List<T>::swap(List<T>& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(length, other.length);
+        std::swap(pool, other.pool);
+        std::swap(cursor, other.cursor);
+        std::swap(cursorIndex, other.cursorIndex);
+    }
+
+    //returns a copy of the list made with a single linear pass
+    template<typename T> List<T> List<T>::clone() const {
+        return List<T>(*this);
+    }
+
+    //inserts a node at the end of the list
+    template<typename T> void List<T>::add(const T& value) {
+        emplaceBack(value);
+    }
+
+    //inserts a node at the end of the list moving the value into it
+    template<typename T> void List<T>::add(T&& value) {
+        emplaceBack(std::move(value));
+    }
 
-            if(parent->prev == head) goto insertIndexIsEqualToZero;
+    //inserts a node at an index in the list
+    template<typename T> void List<T>::add(const T& value, int index) {
+        emplaceAt(index, value);
+    }
 
+    //inserts a node at an index in the list moving the value into it
+    template<typename T> void List<T>::add(T&& value, int index) {
+        emplaceAt(index, std::move(value));
+    }
 
-            Node* t = parent->prev;
-            parent->prev = new Node(value);
-            parent->prev->next = parent;
-            parent->prev->prev = t;
-            t->next = parent->prev;
+    //constructs a node in place at an index in the list
+    template<typename T> template<typename... Args> void List<T>::emplaceAt(int index, Args&&... args) {
+        if(!head || index == 0) {
+            emplaceFront(std::forward<Args>(args)...);
+            return;
         }
 
-        length++;
+        if(index == length) {
+            emplaceBack(std::forward<Args>(args)...);
+            return;
+        }
+
+
+        if(index > 0) {
+            //the node at index is the head only when the index wraps around the list
+            linkBefore(nodeAt(index), createNode(std::forward<Args>(args)...));
+        }
+        else {
+            Node* parent = nodeAt(index + 1);
+
+            if(parent->prev == head)
+                linkBefore(head, createNode(std::forward<Args>(args)...));
+            else
+                linkBefore((parent == head) ? nullptr : parent, createNode(std::forward<Args>(args)...));
+        }
+    }
+
+    //inserts a node after the tail of the list in constant time
+    template<typename T> void List<T>::pushBack(const T& value) {
+        emplaceBack(value);
+    }
+
+    template<typename T> void List<T>::pushBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    //inserts a node before the head of the list in constant time
+    template<typename T> void List<T>::pushFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    template<typename T> void List<T>::pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    //constructs a value in place after the tail of the list and returns its reference
+    template<typename T> template<typename... Args> T& List<T>::emplaceBack(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        linkBefore(nullptr, node);
+
+        return node->getValue();
+    }
+
+    //constructs a value in place before the head of the list and returns its reference
+    template<typename T> template<typename... Args> T& List<T>::emplaceFront(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        linkBefore(head, node);
+
+        return node->getValue();
     }
 
     //returns the number of element in the list
@@ -180,17 +536,22 @@ namespace DSA {
         return this->length;
     }
 
+    //returns the pool the nodes are allocated from, nullptr if nothing has been inserted yet
+    template<typename T> std::shared_ptr<typename List<T>::Pool> List<T>::getPool() const noexcept {
+        return this->pool;
+    }
+
     //returns a string representing the list forward
     template<typename T> std::string List<T>::toString() {
         Node* node = head;
         std::string string = "[";
 
-        
+
         for(int i = 0; i < length; i++) {
             string += std::to_string(node->getValue()) + ((i == length - 1) ? "" : ", ");
             node = node->next;
         }
-        
+
 
         string += "]";
         return string;
@@ -198,7 +559,7 @@ namespace DSA {
 
     //returns a string representing the list backwards
     template<typename T> std::string List<T>::toString(Modality::Verse verse) {
-        if(verse == Modality::Verse::forwords) {
+        if(verse == Modality::Verse::forwords || !head) {
             return this->toString();
         }
         else {
@@ -218,107 +579,158 @@ namespace DSA {
 
     //removes the last element from the list
     template<typename T> void List<T>::remove() {
+        popBack();
+    }
+
+    //removes an element at the specified index of the list
+    template<typename T> void List<T>::remove(int index) {
         if(!head) return;
 
-        if(length == 1) {
-            head = nullptr;
-            length--;
-            return;
-        }
 
+        Node* node = nodeAt(index);
 
-        //head is already the parent of the node to delete (head->prev is the node to delete)
-        Node* node = head->prev;
-        head->prev = node->prev;
-        head->prev->next = head;
+        unlink(node);
+        destroyNode(node);
+    }
 
-        node->next = nullptr;
-        node->prev = nullptr;
+    //removes the tail of the list in constant time
+    template<typename T> void List<T>::popBack() {
+        if(!head) return;
 
-        delete node;
-        length--;
+        Node* node = head->prev;
+        unlink(node);
+        destroyNode(node);
     }
 
-    //removes an element at the specified index of the list
-    template<typename T> void List<T>::remove(int index) {
+    //removes the head of the list in constant time
+    template<typename T> void List<T>::popFront() {
         if(!head) return;
 
-        if(length == 1) {
-            head = nullptr;
-            length--;
-            return;
-        }
+        Node* node = head;
+        unlink(node);
+        destroyNode(node);
+    }
 
-        if(index == 0) {
-            removeIndexIsEqualToZero:
+    //returns the reference to the first value of the list
+    template<typename T> T& List<T>::front() {
+        if(!head) throw std::runtime_error("The List<T> is empty!");
 
-            Node* node = head;
-            head = head->next;
-            head->prev = node->prev;
-            node->prev->next = head;
+        return head->getValue();
+    }
 
-            node->prev = nullptr;
-            node->next = nullptr;
-            delete node;
+    //returns the reference to the last value of the list
+    template<typename T> T& List<T>::back() {
+        if(!head) throw std::runtime_error("The List<T> is empty!");
 
-            length--;
-            return;
-        }
+        return head->prev->getValue();
+    }
 
+    //returns the reference to the value of a node
+    template<typename T> T& List<T>::operator[](int index) {
+        return nodeAt(index)->getValue();
+    }
 
-        Node* parent = head;
-        int i = 0;
-        if(index > 0) {
-            for(; i < index - 1; i++) parent = parent->next;
+    //returns an iterator to the head of the list
+    template<typename T> typename List<T>::Iterator List<T>::begin() noexcept {
+        return Iterator(head, this);
+    }
 
-            if(parent->next == head) goto removeIndexIsEqualToZero;
+    //returns the past-the-end iterator of the list
+    template<typename T> typename List<T>::Iterator List<T>::end() noexcept {
+        return Iterator(nullptr, this);
+    }
 
+    //inserts a value before the position and returns the iterator to it
+    template<typename T> typename List<T>::Iterator List<T>::insert(Iterator position, const T& value) {
+        return emplace(position, value);
+    }
 
+    template<typename T> typename List<T>::Iterator List<T>::insert(Iterator position, T&& value) {
+        return emplace(position, std::move(value));
+    }
 
-            Node* node = parent->next;
-            parent->next = node->next;
-            node->next->prev = parent;
+    //constructs a value in place before the position and returns the iterator to it
+    template<typename T> template<typename... Args> typename List<T>::Iterator List<T>::emplace(Iterator position, Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        linkBefore(position.node, node);
 
-            node->next = nullptr;
-            node->prev = nullptr;
-            delete node;
+        return Iterator(node, this);
+    }
+
+    //removes the element at the position and returns the iterator to the following one
+    template<typename T> typename List<T>::Iterator List<T>::erase(Iterator position) {
+        Node* node = position.node;
+        Node* next = (node->next == head) ? nullptr : node->next;
+
+        unlink(node);
+        destroyNode(node);
+
+        return Iterator(next, this);
+    }
+
+    //moves every node of another list before the position.
+    //the nodes are relinked without copying when both lists share the same pool
+    template<typename T> void List<T>::splice(Iterator position, List<T>& other) {
+        if(&other == this || !other.head) return;
+
+        if(!head) pool = other.pool;
+
+        if(pool != other.pool) {
+            Node* node = other.head;
+
+            for(int i = 0; i < other.length; i++) {
+                linkBefore(position.node, createNode(std::move(node->getValue())));
+                node = node->next;
+            }
+
+            other.clear();
+            return;
         }
-        else {
-            for(int i = 0; i > index + 1; i--) parent = parent->prev;
 
-            if(parent->prev == head) goto removeIndexIsEqualToZero;
 
+        if(!head) {
+            head = other.head;
+            length = other.length;
+        }
+        else {
+            Node* next = position.node ? position.node : head;
+            Node* first = other.head;
+            Node* last = other.head->prev;
 
+            last->next = next;
+            first->prev = next->prev;
+            next->prev->next = first;
+            next->prev = last;
 
-            Node* node = parent->prev;
-            parent->prev = node->prev;
-            node->prev->next = parent;
+            if(position.node == head) head = first;
 
-            node->next = nullptr;
-            node->prev = nullptr;
-            delete node;
+            length += other.length;
         }
 
-        length--;
+        cursor = nullptr;
+
+        other.head = nullptr;
+        other.length = 0;
+        other.cursor = nullptr;
     }
 
-    //returns the reference to the value of a node
-    template<typename T> T& List<T>::operator[](int index) {
-        Node* node = head;
+    //moves a single node of another list (or of this one) before the position
+    template<typename T> void List<T>::splice(Iterator position, List<T>& other, Iterator element) {
+        Node* node = element.node;
 
-        if(index > 0) {
-            for(int i = 0; i < index; i++) node = node->next;
+        if(node == position.node) return;
 
-            return node->getValue();
-        }
-        else if(index < 0) {
-            for(int i = 0; i > index; i--) node = node->prev;
-        
-            return node->getValue();
-        }
-        else {
-            return head->getValue();
+        if(!head) pool = other.pool;
+
+        if(pool != other.pool) {
+            linkBefore(position.node, createNode(std::move(node->getValue())));
+            other.erase(element);
+            return;
         }
+
+
+        other.unlink(node);
+        linkBefore(position.node, node);
     }
 
 
@@ -337,7 +749,7 @@ namespace DSA {
 
     //NODE
     //CONSTRUCTOR
-    template<typename T> List<T>::Node::Node(T value): value(value) {}
+    template<typename T> template<typename... Args> List<T>::Node::Node(Args&&... args): value(std::forward<Args>(args)...) {}
 
 
 
@@ -346,13 +758,13 @@ namespace DSA {
 
     //METHODS
     //sets the value of the node
-    template<typename T> void List<T>::Node::setValue(T value) {
-        try {
-            this->value = value;
-        }
-        catch(...) {
-            std::cout<< "Cannot assign the value to List<T>::Node::value or print out the value you're trying to assign and the value of List<T>::Node::value.";
-        }    
+    template<typename T> void List<T>::Node::setValue(const T& value) {
+        this->value = value;
+    }
+
+    //sets the value of the node moving it
+    template<typename T> void List<T>::Node::setValue(T&& value) {
+        this->value = std::move(value);
     }
 
     //returns the reference of the value of the node
@@ -364,80 +776,5308 @@ namespace DSA {
 
 
 
-    #pragma endregion
 
-    #pragma region HASHMAP
-    //Pair<T> class definition
-    //this class is used inside the class HashMap<T> and HashMap<T>::Bucket in which it rappresents
-    //a key associated with a value
-    template<typename T> class Pair final {
-        private:
-            const std::string key;
-            T value;
 
 
-        public:
-            const std::string getKey(void) const noexcept;
-            T& getValue(void) noexcept;
-            void setValue(T);
-            std::string toString();
-            std::string toString(Modality::Association);
+    //POOL
+    //CONSTRUCTOR
+    //slabSize is the number of nodes allocated at once every time the pool runs out of slots
+    template<typename T> List<T>::Pool::Pool(std::size_t slabSize): freeSlots(nullptr), slabSize(slabSize ? slabSize : 1), currentSlab(0), usedSlots(0) {}
 
+    //DESTRUCTOR
+    template<typename T> List<T>::Pool::~Pool() {
+        for(Slot* slab : slabs) delete[] slab;
+    }
 
-            Pair(void) = delete;
-            Pair(std::string, T);
-    };
 
 
-    //HashMap<T> class definition
-    template<typename T> class HashMap final {
-        private:
-            //private inner class Bucket that can only be used inside HashMap<T> class
-            class Bucket final {
-                private:
-                    List<Pair<T>> bucket;
+
+    //METHODS
+    //returns an uninitialized slot for a node, recycled slots are reused before new ones
+    template<typename T> void* List<T>::Pool::allocate() {
+        if(freeSlots) {
+            Slot* slot = freeSlots;
+            freeSlots = slot->next;
+            return slot;
+        }
+
+
+        if(usedSlots == slabSize) {
+            currentSlab++;
+            usedSlots = 0;
+        }
+
+        if(currentSlab == slabs.size()) slabs.push_back(new Slot[slabSize]);
+
+
+        return &slabs[currentSlab][usedSlots++];
+    }
+
+    //puts a slot back in the free list
+    template<typename T> void List<T>::Pool::deallocate(void* pointer) noexcept {
+        Slot* slot = static_cast<Slot*>(pointer);
+        slot->next = freeSlots;
+        freeSlots = slot;
+    }
+
+    //marks every slot of every slab as free, the slabs are kept to be reused
+    template<typename T> void List<T>::Pool::reset() noexcept {
+        freeSlots = nullptr;
+        currentSlab = 0;
+        usedSlots = 0;
+    }
+
+    //returns the number of slots allocated by the pool
+    template<typename T> std::size_t List<T>::Pool::getCapacity() const noexcept {
+        return slabs.size() * slabSize;
+    }
+
+
+
+
+
+
+
+
+    //ITERATOR
+    //CONSTRUCTOR
+    template<typename T> List<T>::Iterator::Iterator() noexcept: node(nullptr), list(nullptr) {}
+
+    //CONSTRUCTOR
+    template<typename T> List<T>::Iterator::Iterator(Node* node, const List<T>* list) noexcept: node(node), list(list) {}
+
+
+
+
+    //METHODS
+    //returns the reference to the value the iterator points to
+    template<typename T> T& List<T>::Iterator::operator*() const noexcept {
+        return node->getValue();
+    }
+
+    //returns the pointer to the value the iterator points to
+    template<typename T> T* List<T>::Iterator::operator->() const noexcept {
+        return &node->getValue();
+    }
+
+    //moves to the next node, the tail is followed by end()
+    template<typename T> typename List<T>::Iterator& List<T>::Iterator::operator++() noexcept {
+        node = (node->next == list->head) ? nullptr : node->next;
+        return *this;
+    }
+
+    template<typename T> typename List<T>::Iterator List<T>::Iterator::operator++(int) noexcept {
+        Iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    //moves to the previous node, end() is preceded by the tail
+    template<typename T> typename List<T>::Iterator& List<T>::Iterator::operator--() noexcept {
+        node = node ? node->prev : list->head->prev;
+        return *this;
+    }
+
+    template<typename T> typename List<T>::Iterator List<T>::Iterator::operator--(int) noexcept {
+        Iterator previous = *this;
+        --(*this);
+        return previous;
+    }
+
+    template<typename T> bool List<T>::Iterator::operator==(const Iterator& other) const noexcept {
+        return node == other.node;
+    }
+
+    template<typename T> bool List<T>::Iterator::operator!=(const Iterator& other) const noexcept {
+        return node != other.node;
+    }
+
+
+
+
+
+    #pragma endregion
+
+    #pragma region UNROLLEDLIST
+
+    //UnrolledList<T> class definition
+    //it has the same interface of List<T> but every node (chunk) stores up to ChunkCapacity values
+    //contiguously, so that traversals and indexing only hop between about length / ChunkCapacity nodes.
+    //by default the values and the three fields of a chunk fill 64 bytes, at least four values are stored anyway.
+    //inserting or removing an element invalidates the iterators to the chunk it belongs to, and a removal that
+    //merges the following chunk into it also invalidates the iterators to the following chunk
+    template<typename T, int ChunkCapacity = (((64 - 3 * sizeof(void*)) / sizeof(T)) > 4) ? int((64 - 3 * sizeof(void*)) / sizeof(T)) : 4> class UnrolledList final {
+        static_assert(ChunkCapacity > 1, "An UnrolledList<T> chunk has to store at least two values");
+
+        private:
+            //inner Chunk class, the values are stored in raw memory and only the first count are constructed
+            class Chunk final {
+                private:
+                    alignas(T) unsigned char storage[sizeof(T) * ChunkCapacity];
+
+
+                public:
+                    Chunk* next;
+                    Chunk* prev;
+                    int count;
+
+
+                    T* getValues(void) noexcept;
+                    T& getValue(int) noexcept;
+                    template<typename... Args> void emplace(int, Args&&...);
+                    void erase(int) noexcept(std::is_nothrow_move_assignable_v<T>);
+                    void moveTail(int, Chunk*) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+
+                    Chunk(void) noexcept;
+                    ~Chunk(void);
+            };
+
+            Chunk* first;
+            Chunk* last;
+            int length;
+
+
+            Chunk* findChunk(int&) noexcept;
+            Chunk* splitChunk(Chunk*);
+            Chunk* insertChunkAfter(Chunk*);
+            void removeChunk(Chunk*) noexcept;
+            void mergeChunk(Chunk*) noexcept(std::is_nothrow_move_constructible_v<T>);
+            int normalizeIndex(int) const noexcept;
+
+
+
+        public:
+            //bidirectional iterator over the values, the end() iterator is represented by a null chunk
+            class Iterator final {
+                private:
+                    Chunk* chunk;
+                    int offset;
+                    const UnrolledList<T, ChunkCapacity>* list;
+
+
+                    Iterator(Chunk*, int, const UnrolledList<T, ChunkCapacity>*) noexcept;
+
+                    friend class UnrolledList<T, ChunkCapacity>;
 
 
                 public:
-                    void add(Pair<T>&);
-                    void remove(std::string&);
-                    T& operator[](std::string&);
-                    bool exist(std::string&);
-                    std::string toString(void);
-                    std::string toString(Modality::Association);
-                    std::vector<Pair<T>*> getPairs(void);
+                    using iterator_category = std::bidirectional_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = T*;
+                    using reference = T&;
+
+
+                    T& operator*(void) const noexcept;
+                    T* operator->(void) const noexcept;
+                    Iterator& operator++(void) noexcept;
+                    Iterator operator++(int) noexcept;
+                    Iterator& operator--(void) noexcept;
+                    Iterator operator--(int) noexcept;
+                    bool operator==(const Iterator&) const noexcept;
+                    bool operator!=(const Iterator&) const noexcept;
+
+
+                    Iterator(void) noexcept;
+            };
+
+
+            void add(const T&);
+            void add(T&&);
+            void add(const T&, int);
+            void add(T&&, int);
+            void remove(void);
+            void remove(int);
+            void pushBack(const T&);
+            void pushBack(T&&);
+            void pushFront(const T&);
+            void pushFront(T&&);
+            template<typename... Args> T& emplaceBack(Args&&...);
+            template<typename... Args> T& emplaceFront(Args&&...);
+            void popBack(void);
+            void popFront(void);
+            T& front(void);
+            T& back(void);
+            T& operator[](int);
+            Iterator begin(void) noexcept;
+            Iterator end(void) noexcept;
+            Iterator insert(Iterator, const T&);
+            Iterator insert(Iterator, T&&);
+            template<typename... Args> Iterator emplace(Iterator, Args&&...);
+            Iterator erase(Iterator);
+            void clear(void) noexcept;
+            void swap(UnrolledList<T, ChunkCapacity>&) noexcept;
+            UnrolledList<T, ChunkCapacity> clone(void) const;
+            int getLength(void) const noexcept;
+            std::string toString(void);
+            std::string toString(Modality::Verse);
+
+
+            UnrolledList<T, ChunkCapacity>& operator=(const UnrolledList<T, ChunkCapacity>&);
+            UnrolledList<T, ChunkCapacity>& operator=(UnrolledList<T, ChunkCapacity>&&) noexcept;
+
+            UnrolledList(void);
+            UnrolledList(const UnrolledList<T, ChunkCapacity>&);
+            UnrolledList(UnrolledList<T, ChunkCapacity>&&) noexcept;
+            ~UnrolledList(void);
+    };
+
+
+
+
+
+
+
+
+
+    //UNROLLEDLIST
+    //CONSTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::UnrolledList() {
+        this->first = nullptr;
+        this->last = nullptr;
+        this->length = 0;
+    }
+
+    //COPY CONSTRUCTOR
+    //copies the values chunk by chunk keeping the same layout
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::UnrolledList(const UnrolledList<T, ChunkCapacity>& other): UnrolledList() {
+        for(Chunk* chunk = other.first; chunk; chunk = chunk->next) {
+            Chunk* copy = insertChunkAfter(last);
+
+            for(int i = 0; i < chunk->count; i++) copy->emplace(i, chunk->getValue(i));
+
+            length += chunk->count;
+        }
+    }
+
+    //MOVE CONSTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::UnrolledList(UnrolledList<T, ChunkCapacity>&& other) noexcept: UnrolledList() {
+        swap(other);
+    }
+
+    //DESTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::~UnrolledList() {
+        clear();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>& UnrolledList<T, ChunkCapacity>::operator=(const UnrolledList<T, ChunkCapacity>& other) {
+        if(this != &other) {
+            UnrolledList<T, ChunkCapacity> copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>& UnrolledList<T, ChunkCapacity>::operator=(UnrolledList<T, ChunkCapacity>&& other) noexcept {
+        if(this != &other) {
+            clear();
+            swap(other);
+        }
+
+        return *this;
+    }
+
+
+    //METHODS
+    //maps an index, also negative or greater than the length, to a position inside the list like List<T>::operator[] does
+    template<typename T, int ChunkCapacity> int UnrolledList<T, ChunkCapacity>::normalizeIndex(int index) const noexcept {
+        index %= length;
+
+        return (index < 0) ? index + length : index;
+    }
+
+    //returns the chunk containing the value at index and replaces index with the offset inside that chunk.
+    //the chunks are walked from the nearest end of the list
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Chunk* UnrolledList<T, ChunkCapacity>::findChunk(int& index) noexcept {
+        if(index < length / 2) {
+            Chunk* chunk = first;
+
+            while(index >= chunk->count) {
+                index -= chunk->count;
+                chunk = chunk->next;
+            }
+
+            return chunk;
+        }
+        else {
+            Chunk* chunk = last;
+            int start = length - chunk->count;
+
+            while(index < start) {
+                chunk = chunk->prev;
+                start -= chunk->count;
+            }
+
+            index -= start;
+            return chunk;
+        }
+    }
+
+    //allocates an empty chunk after another one, a null chunk means before the first one
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Chunk* UnrolledList<T, ChunkCapacity>::insertChunkAfter(Chunk* chunk) {
+        Chunk* newChunk = new Chunk();
+
+        newChunk->prev = chunk;
+        newChunk->next = chunk ? chunk->next : first;
+
+        if(newChunk->next) newChunk->next->prev = newChunk;
+        else last = newChunk;
+
+        if(chunk) chunk->next = newChunk;
+        else first = newChunk;
+
+
+        return newChunk;
+    }
+
+    //moves the upper half of a full chunk into a new chunk that follows it
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Chunk* UnrolledList<T, ChunkCapacity>::splitChunk(Chunk* chunk) {
+        Chunk* newChunk = insertChunkAfter(chunk);
+
+        try {
+            chunk->moveTail(chunk->count / 2, newChunk);
+        }
+        catch(...) {
+            removeChunk(newChunk);
+            throw;
+        }
+
+
+        return newChunk;
+    }
+
+    //unlinks and deletes a chunk
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::removeChunk(Chunk* chunk) noexcept {
+        if(chunk->prev) chunk->prev->next = chunk->next;
+        else first = chunk->next;
+
+        if(chunk->next) chunk->next->prev = chunk->prev;
+        else last = chunk->prev;
+
+
+        delete chunk;
+    }
+
+    //merges the following chunk into a chunk that is less than half full when they fit together
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::mergeChunk(Chunk* chunk) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        Chunk* next = chunk->next;
+
+        if(chunk->count >= ChunkCapacity / 2 || !next || chunk->count + next->count > ChunkCapacity) return;
+
+
+        next->moveTail(0, chunk);
+        removeChunk(next);
+    }
+
+    //inserts a value at the end of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::add(const T& value) {
+        emplaceBack(value);
+    }
+
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::add(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    //inserts a value at an index of the list, negative indexes count from the end like in List<T>.
+    //unlike List<T>, an index out of the list isn't wrapped around: the value is added at the front or at the end
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::add(const T& value, int index) {
+        if(index < 0) index += length + 1;
+
+        if(index <= 0 || length == 0) emplaceFront(value);
+        else if(index >= length) emplaceBack(value);
+        else {
+            Chunk* chunk = findChunk(index);
+            emplace(Iterator(chunk, index, this), value);
+        }
+    }
+
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::add(T&& value, int index) {
+        if(index < 0) index += length + 1;
+
+        if(index <= 0 || length == 0) emplaceFront(std::move(value));
+        else if(index >= length) emplaceBack(std::move(value));
+        else {
+            Chunk* chunk = findChunk(index);
+            emplace(Iterator(chunk, index, this), std::move(value));
+        }
+    }
+
+    //inserts a value after the last one
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::pushBack(const T& value) {
+        emplaceBack(value);
+    }
+
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::pushBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    //inserts a value before the first one
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::pushFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    //constructs a value in place after the last one, a new chunk is allocated only when the last one is full
+    template<typename T, int ChunkCapacity> template<typename... Args> T& UnrolledList<T, ChunkCapacity>::emplaceBack(Args&&... args) {
+        if(!last || last->count == ChunkCapacity) insertChunkAfter(last);
+
+        last->emplace(last->count, std::forward<Args>(args)...);
+        length++;
+
+        return last->getValue(last->count - 1);
+    }
+
+    //constructs a value in place before the first one, a new chunk is allocated only when the first one is full
+    template<typename T, int ChunkCapacity> template<typename... Args> T& UnrolledList<T, ChunkCapacity>::emplaceFront(Args&&... args) {
+        if(!first || first->count == ChunkCapacity) insertChunkAfter(nullptr);
+
+        first->emplace(0, std::forward<Args>(args)...);
+        length++;
+
+        return first->getValue(0);
+    }
+
+    //removes the last value of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::remove() {
+        popBack();
+    }
+
+    //removes the value at the specified index of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::remove(int index) {
+        if(length == 0) return;
+
+        index = normalizeIndex(index);
+        Chunk* chunk = findChunk(index);
+
+        erase(Iterator(chunk, index, this));
+    }
+
+    //removes the last value of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::popBack() {
+        if(!last) return;
+
+        last->erase(last->count - 1);
+        length--;
+
+        if(last->count == 0) removeChunk(last);
+    }
+
+    //removes the first value of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::popFront() {
+        if(!first) return;
+
+        first->erase(0);
+        length--;
+
+        if(first->count == 0) removeChunk(first);
+    }
+
+    //returns the reference to the first value of the list
+    template<typename T, int ChunkCapacity> T& UnrolledList<T, ChunkCapacity>::front() {
+        if(!first) throw std::runtime_error("The UnrolledList<T> is empty!");
+
+        return first->getValue(0);
+    }
+
+    //returns the reference to the last value of the list
+    template<typename T, int ChunkCapacity> T& UnrolledList<T, ChunkCapacity>::back() {
+        if(!last) throw std::runtime_error("The UnrolledList<T> is empty!");
+
+        return last->getValue(last->count - 1);
+    }
+
+    //returns the reference to the value at an index, indexes wrap around the list like in List<T>
+    template<typename T, int ChunkCapacity> T& UnrolledList<T, ChunkCapacity>::operator[](int index) {
+        if(length == 0) throw std::runtime_error("The UnrolledList<T> is empty!");
+
+        index = normalizeIndex(index);
+        Chunk* chunk = findChunk(index);
+
+        return chunk->getValue(index);
+    }
+
+    //returns an iterator to the first value of the list
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::begin() noexcept {
+        return Iterator(first, 0, this);
+    }
+
+    //returns the past-the-end iterator of the list
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::end() noexcept {
+        return Iterator(nullptr, 0, this);
+    }
+
+    //inserts a value before the position and returns the iterator to it
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::insert(Iterator position, const T& value) {
+        return emplace(position, value);
+    }
+
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::insert(Iterator position, T&& value) {
+        return emplace(position, std::move(value));
+    }
+
+    //constructs a value in place before the position and returns the iterator to it
+    template<typename T, int ChunkCapacity> template<typename... Args> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::emplace(Iterator position, Args&&... args) {
+        Chunk* chunk = position.chunk;
+        int offset = position.offset;
+
+
+        if(!chunk) {
+            emplaceBack(std::forward<Args>(args)...);
+            return Iterator(last, last->count - 1, this);
+        }
+
+        if(chunk->count == ChunkCapacity) {
+            //the value is built before the split because the arguments may refer to a value that is moved by it
+            T value(std::forward<Args>(args)...);
+            Chunk* newChunk = splitChunk(chunk);
+
+            if(offset > chunk->count) {
+                offset -= chunk->count;
+                chunk = newChunk;
+            }
+
+            chunk->emplace(offset, std::move(value));
+        }
+        else {
+            chunk->emplace(offset, std::forward<Args>(args)...);
+        }
+
+        length++;
+
+        return Iterator(chunk, offset, this);
+    }
+
+    //removes the value at the position and returns the iterator to the following one. when the chunk is merged with
+    //the following one, the iterators to the values of the following chunk are invalidated too
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::erase(Iterator position) {
+        Chunk* chunk = position.chunk;
+        int offset = position.offset;
+
+        chunk->erase(offset);
+        length--;
+
+
+        if(chunk->count == 0) {
+            Chunk* next = chunk->next;
+            removeChunk(chunk);
+
+            return Iterator(next, 0, this);
+        }
+
+        mergeChunk(chunk);
+
+
+        if(offset < chunk->count) return Iterator(chunk, offset, this);
+
+        return Iterator(chunk->next, 0, this);
+    }
+
+    //removes every value of the list
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::clear() noexcept {
+        while(first) {
+            Chunk* next = first->next;
+            delete first;
+            first = next;
+        }
+
+        last = nullptr;
+        length = 0;
+    }
+
+    //exchanges the content of two lists in constant time
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::swap(UnrolledList<T, ChunkCapacity>& other) noexcept {
+        std::swap(first, other.first);
+        std::swap(last, other.last);
+        std::swap(length, other.length);
+    }
+
+    //returns a copy of the list made with a single linear pass
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity> UnrolledList<T, ChunkCapacity>::clone() const {
+        return UnrolledList<T, ChunkCapacity>(*this);
+    }
+
+    //returns the number of values in the list
+    template<typename T, int ChunkCapacity> int UnrolledList<T, ChunkCapacity>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //returns a string representing the list forward
+    template<typename T, int ChunkCapacity> std::string UnrolledList<T, ChunkCapacity>::toString() {
+        std::string string = "[";
+
+        for(Chunk* chunk = first; chunk; chunk = chunk->next) {
+            for(int i = 0; i < chunk->count; i++)
+                string += std::to_string(chunk->getValue(i)) + ((!chunk->next && i == chunk->count - 1) ? "" : ", ");
+        }
+
+
+        string += "]";
+        return string;
+    }
+
+    //returns a string representing the list with the specified verse
+    template<typename T, int ChunkCapacity> std::string UnrolledList<T, ChunkCapacity>::toString(Modality::Verse verse) {
+        if(verse == Modality::Verse::forwords) {
+            return this->toString();
+        }
+        else {
+            std::string string = "[";
+
+            for(Chunk* chunk = last; chunk; chunk = chunk->prev) {
+                for(int i = chunk->count - 1; i > -1; i--)
+                    string += std::to_string(chunk->getValue(i)) + ((!chunk->prev && i == 0) ? "" : ", ");
+            }
+
+
+            string += "]";
+            return string;
+        }
+    }
+
+
+
+
+
+
+
+
+
+    //CHUNK
+    //CONSTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::Chunk::Chunk() noexcept: next(nullptr), prev(nullptr), count(0) {}
+
+    //DESTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::Chunk::~Chunk() {
+        for(int i = 0; i < count; i++) getValues()[i].~T();
+    }
+
+
+
+
+    //METHODS
+    //returns the pointer to the first value stored in the chunk
+    template<typename T, int ChunkCapacity> T* UnrolledList<T, ChunkCapacity>::Chunk::getValues() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+
+    //returns the reference to the value at an offset of the chunk
+    template<typename T, int ChunkCapacity> T& UnrolledList<T, ChunkCapacity>::Chunk::getValue(int offset) noexcept {
+        return getValues()[offset];
+    }
+
+    //constructs a value at an offset of a chunk that is not full, shifting the following values up
+    template<typename T, int ChunkCapacity> template<typename... Args> void UnrolledList<T, ChunkCapacity>::Chunk::emplace(int offset, Args&&... args) {
+        T* values = getValues();
+
+        if(offset == count) {
+            new (values + count) T(std::forward<Args>(args)...);
+            count++;
+            return;
+        }
+
+
+        T value(std::forward<Args>(args)...);
+
+        new (values + count) T(std::move(values[count - 1]));
+        count++;
+
+        for(int i = count - 2; i > offset; i--) values[i] = std::move(values[i - 1]);
+
+        values[offset] = std::move(value);
+    }
+
+    //removes the value at an offset of the chunk, shifting the following values down
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::Chunk::erase(int offset) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        T* values = getValues();
+
+        for(int i = offset; i < count - 1; i++) values[i] = std::move(values[i + 1]);
+
+        values[count - 1].~T();
+        count--;
+    }
+
+    //moves the values from an offset to the end of the chunk at the end of another chunk.
+    //values whose move constructor may throw are copied, so both chunks are left as they were on failure
+    template<typename T, int ChunkCapacity> void UnrolledList<T, ChunkCapacity>::Chunk::moveTail(int offset, Chunk* other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        T* values = getValues();
+        T* otherValues = other->getValues();
+        const int otherCount = other->count;
+
+
+        if constexpr(std::is_nothrow_move_constructible_v<T>) {
+            for(int i = offset; i < count; i++) {
+                new (otherValues + other->count) T(std::move(values[i]));
+                values[i].~T();
+                other->count++;
+            }
+        }
+        else {
+            try {
+                for(int i = offset; i < count; i++) {
+                    new (otherValues + other->count) T(std::move_if_noexcept(values[i]));
+                    other->count++;
+                }
+            }
+            catch(...) {
+                while(other->count > otherCount) otherValues[--other->count].~T();
+                throw;
+            }
+
+            for(int i = offset; i < count; i++) values[i].~T();
+        }
+
+        count = offset;
+    }
+
+
+
+
+
+
+
+
+
+    //ITERATOR
+    //CONSTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::Iterator::Iterator() noexcept: chunk(nullptr), offset(0), list(nullptr) {}
+
+    //CONSTRUCTOR
+    template<typename T, int ChunkCapacity> UnrolledList<T, ChunkCapacity>::Iterator::Iterator(Chunk* chunk, int offset, const UnrolledList<T, ChunkCapacity>* list) noexcept: chunk(chunk), offset(offset), list(list) {}
+
+
+
+
+    //METHODS
+    //returns the reference to the value the iterator points to
+    template<typename T, int ChunkCapacity> T& UnrolledList<T, ChunkCapacity>::Iterator::operator*() const noexcept {
+        return chunk->getValue(offset);
+    }
+
+    //returns the pointer to the value the iterator points to
+    template<typename T, int ChunkCapacity> T* UnrolledList<T, ChunkCapacity>::Iterator::operator->() const noexcept {
+        return &chunk->getValue(offset);
+    }
+
+    //moves to the next value, crossing into the next chunk at the end of the current one
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator& UnrolledList<T, ChunkCapacity>::Iterator::operator++() noexcept {
+        if(++offset == chunk->count) {
+            chunk = chunk->next;
+            offset = 0;
+        }
+
+        return *this;
+    }
+
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::Iterator::operator++(int) noexcept {
+        Iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    //moves to the previous value, end() is preceded by the last value of the last chunk
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator& UnrolledList<T, ChunkCapacity>::Iterator::operator--() noexcept {
+        if(!chunk) {
+            chunk = list->last;
+            offset = chunk->count - 1;
+        }
+        else if(offset == 0) {
+            chunk = chunk->prev;
+            offset = chunk->count - 1;
+        }
+        else {
+            offset--;
+        }
+
+        return *this;
+    }
+
+    template<typename T, int ChunkCapacity> typename UnrolledList<T, ChunkCapacity>::Iterator UnrolledList<T, ChunkCapacity>::Iterator::operator--(int) noexcept {
+        Iterator previous = *this;
+        --(*this);
+        return previous;
+    }
+
+    template<typename T, int ChunkCapacity> bool UnrolledList<T, ChunkCapacity>::Iterator::operator==(const Iterator& other) const noexcept {
+        return chunk == other.chunk && offset == other.offset;
+    }
+
+    template<typename T, int ChunkCapacity> bool UnrolledList<T, ChunkCapacity>::Iterator::operator!=(const Iterator& other) const noexcept {
+        return !(*this == other);
+    }
+
+
+
+
+
+    #pragma endregion
+
+    #pragma region HASHMAP
+    //asks the processor to load the cache line of an address, it's only a hint and never faults
+    inline void prefetchAddress(const void* address) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+        #elif defined(__SSE2__) || defined(_M_X64)
+            _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+        #else
+            (void)address;
+        #endif
+    }
+
+    //returns the index of the lowest set bit of a non zero mask
+    inline int lowestBit(std::uint32_t mask) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(mask);
+        #else
+            int index = 0;
+
+            while(!(mask & 1u)) {
+                mask >>= 1;
+                index++;
+            }
+
+            return index;
+        #endif
+    }
+
+
+    //Hash<K> class definition
+    //it is the default hasher of HashMap<K, V>, a custom hasher is any class whose operator()
+    //receives a key and returns a well distributed std::uint64_t.
+    //keys without a specialization are hashed by std::hash, whose result is mixed again because
+    //for many types it's the identity
+    template<typename K, typename = void> struct Hash final {
+        public:
+            std::uint64_t operator()(const K&) const;
+    };
+
+    //hash of integral and enum keys, the value is mixed with the finalizer of MurmurHash3 so that
+    //no memory is read and consecutive keys spread over the whole table
+    template<typename K> struct Hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> final {
+        public:
+            static std::uint64_t mixInteger(std::uint64_t) noexcept;
+            std::uint64_t operator()(K) const noexcept;
+    };
+
+    //hash of std::string keys, it follows the wyhash construction: the key is read 8 bytes at a time
+    //and every pair of words is folded with a 64x64->128 bit multiplication.
+    //it hashes any std::string_view, so std::string and const char* keys give the same hash without copies
+    template<> struct Hash<std::string> final {
+        private:
+            static constexpr std::uint64_t secret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+
+            static void multiply(std::uint64_t&, std::uint64_t&) noexcept;
+            static std::uint64_t mix(std::uint64_t, std::uint64_t) noexcept;
+            static std::uint64_t read64(const unsigned char*) noexcept;
+            static std::uint64_t read32(const unsigned char*) noexcept;
+
+
+        public:
+            static std::uint64_t hashBytes(const void*, std::size_t, std::uint64_t = 0) noexcept;
+            std::uint64_t operator()(std::string_view) const noexcept;
+    };
+
+
+    //PairTraits<K, V> class definition
+    //it gives the key and value types of Pair<K, V> and HashMap<K, V>: with a single type argument
+    //the key is a std::string and the argument is the type of the value, as in the original Pair<T>
+    template<typename K, typename V> struct PairTraits final {
+        using Key = K;
+        using Value = V;
+    };
+
+    template<typename T> struct PairTraits<T, void> final {
+        using Key = std::string;
+        using Value = T;
+    };
+
+
+    //Pair<K, V> class definition
+    //this class is used inside the class HashMap<K, V> in which it rappresents
+    //a key associated with a value
+    template<typename K, typename V = void> class Pair final {
+        public:
+            using Key = typename PairTraits<K, V>::Key;
+            using Value = typename PairTraits<K, V>::Value;
+
+
+        private:
+            Key key;
+            Value value;
+
+
+        public:
+            const Key& getKey(void) const noexcept;
+            Value& getValue(void) noexcept;
+            void setValue(const Value&);
+            void setValue(Value&&);
+            std::string toString();
+            std::string toString(Modality::Association);
+
+            template<typename Other> static std::string keyToString(const Other&);
+
+
+            Pair(void) = delete;
+            Pair(Key, Value);
+            template<typename... Args> Pair(Key, std::in_place_t, Args&&...);
+    };
+
+
+    //ChainedTable<E> class definition
+    //it is the default storage of HashMap<K, V>: the elements are kept in an array of nodes and every bucket
+    //is a chain of nodes linked by their index, the nodes of the removed elements are reused by the next insertions.
+    //the number of buckets is always a power of two and it doubles when the load factor exceeds its maximum,
+    //the chains are moved to the new table a few buckets at a time by the following calls to step(),
+    //so that growing never stops the map for a whole rehash
+    //
+    //a table stores elements without knowing their keys: lookups receive the hash value and a predicate
+    //that recognizes the element, rehashing receives a function that returns the hash value of an element
+    template<typename E> class ChainedTable final {
+        private:
+            //node of a chain, next is the index of the following node
+            struct Node {
+                E element;
+                std::uint32_t next;
+            };
+
+
+            //index that ends a chain
+            static constexpr std::uint32_t nullNode = 0xFFFFFFFFu;
+
+            //number of old buckets moved to the new table by every step while rehashing
+            static constexpr std::size_t rehashStepBuckets = 4;
+
+
+
+
+            std::vector<Node> nodes;
+            std::vector<std::uint32_t> hashTable;
+            std::vector<std::uint32_t> oldHashTable;
+            std::size_t rehashIndex;
+            std::uint32_t freeNode;
+            std::size_t length;
+            float maxLoadFactor;
+
+
+            std::uint32_t& findBucket(std::uint64_t);
+            template<typename HashOf> void startRehash(std::size_t, HashOf&);
+
+
+        public:
+            template<typename Match> E* find(std::uint64_t, Match&&);
+            template<typename... Args> E& insert(std::uint64_t, Args&&...);
+            template<typename Match> bool erase(std::uint64_t, Match&&);
+            template<typename HashOf> void step(HashOf&&);
+            template<typename HashOf> void grow(HashOf&&);
+            template<typename HashOf> void reserve(std::size_t, HashOf&&);
+            template<typename Visitor> void forEach(Visitor&&);
+            void prefetch(std::uint64_t) const noexcept;
+            const E* findCandidate(std::uint64_t) const noexcept;
+            std::size_t getLength(void) const noexcept;
+            std::size_t getBucketNumber(void) const noexcept;
+            float getLoadFactor(void) const noexcept;
+            void setMaxLoadFactor(float);
+
+
+            ChainedTable<E>& operator=(const ChainedTable<E>&) = default;
+            ChainedTable<E>& operator=(ChainedTable<E>&&) noexcept;
+
+            explicit ChainedTable(std::size_t);
+            ChainedTable(const ChainedTable<E>&) = default;
+            ChainedTable(ChainedTable<E>&&) noexcept;
+    };
+
+
+    //FlatTable<E> class definition
+    //open addressing storage in the style of SwissTable: the elements are stored inline in a contiguous
+    //array of slots and every slot has a control byte that is either empty, deleted or 7 bits of the hash
+    //of its element. a lookup compares the control bytes of 16 slots at a time (with SSE2 when available)
+    //and only touches the slots whose 7 bits match.
+    //growing rehashes the whole table at once and invalidates the references to the elements
+    template<typename E> class FlatTable final {
+        private:
+            struct alignas(E) Slot {
+                unsigned char storage[sizeof(E)];
+            };
+
+
+            static constexpr std::int8_t emptyControl = -128;
+            static constexpr std::int8_t deletedControl = -2;
+            static constexpr std::size_t groupWidth = 16;
+
+
+
+
+            //the control array has groupWidth more bytes that mirror the first ones, so that
+            //a group can always be loaded without wrapping around the end of the table
+            std::unique_ptr<std::int8_t[]> control;
+            std::unique_ptr<Slot[]> slots;
+            std::size_t capacity;
+            std::size_t length;
+            std::size_t deletedNumber;
+            float maxLoadFactor;
+
+
+            E& getElement(std::size_t) noexcept;
+            void setControl(std::size_t, std::int8_t) noexcept;
+            std::size_t findFreeSlot(std::uint64_t) const noexcept;
+            void destroyElements(void) noexcept;
+            template<typename HashOf> void rehash(std::size_t, HashOf&);
+
+            static std::uint32_t matchControl(const std::int8_t*, std::int8_t) noexcept;
+            static std::uint32_t matchFree(const std::int8_t*) noexcept;
+
+
+        public:
+            template<typename Match> E* find(std::uint64_t, Match&&);
+            template<typename... Args> E& insert(std::uint64_t, Args&&...);
+            template<typename Match> bool erase(std::uint64_t, Match&&);
+            template<typename HashOf> void step(HashOf&&);
+            template<typename HashOf> void grow(HashOf&&);
+            template<typename HashOf> void reserve(std::size_t, HashOf&&);
+            template<typename Visitor> void forEach(Visitor&&);
+            void prefetch(std::uint64_t) const noexcept;
+            const E* findCandidate(std::uint64_t) const noexcept;
+            std::size_t getLength(void) const noexcept;
+            std::size_t getBucketNumber(void) const noexcept;
+            float getLoadFactor(void) const noexcept;
+            void setMaxLoadFactor(float);
+
+
+            FlatTable<E>& operator=(const FlatTable<E>&);
+            FlatTable<E>& operator=(FlatTable<E>&&) noexcept;
+
+            explicit FlatTable(std::size_t);
+            FlatTable(const FlatTable<E>&);
+            FlatTable(FlatTable<E>&&) noexcept;
+            ~FlatTable(void);
+    };
+
+
+    //CountingBloomFilter class definition
+    //membership filter of hash values that HashMap<K, V> can keep in front of its table: a value that has never been
+    //added is rejected without touching the table. every value selects a 64 byte block and 4 of the 128 counters
+    //of 4 bits in it, so a test reads a single cache line. the counters are incremented by add() and decremented by
+    //remove(), a counter that reaches 15 stays saturated so that it can never go back to zero by mistake
+    class CountingBloomFilter final {
+        private:
+            struct alignas(64) Block {
+                std::uint8_t counters[64];
+            };
+
+
+            //number of counters set by every value and number of counters allocated for every value
+            static constexpr int hashNumber = 4;
+            static constexpr std::size_t countersPerValue = 12;
+
+
+
+
+            std::vector<Block> blocks;
+            std::size_t capacity;
+            std::uint64_t lookups;
+            std::uint64_t negatives;
+            std::uint64_t falsePositives;
+
+
+            Block& findBlock(std::uint64_t) noexcept;
+            const Block& findBlock(std::uint64_t) const noexcept;
+            static unsigned getCounter(const Block&, unsigned) noexcept;
+            static void setCounter(Block&, unsigned, unsigned) noexcept;
+            static unsigned getPosition(std::uint64_t, int) noexcept;
+
+
+        public:
+            void add(std::uint64_t) noexcept;
+            void remove(std::uint64_t) noexcept;
+            bool mayContain(std::uint64_t) const noexcept;
+            bool test(std::uint64_t) noexcept;
+            void recordFalsePositive(void) noexcept;
+            void resize(std::size_t);
+            std::size_t getCapacity(void) const noexcept;
+            std::uint64_t getLookups(void) const noexcept;
+            std::uint64_t getNegatives(void) const noexcept;
+            std::uint64_t getFalsePositives(void) const noexcept;
+            float getFalsePositiveRate(void) const noexcept;
+
+
+            explicit CountingBloomFilter(std::size_t);
+    };
+
+
+    //read only view of a saved HashMap<K, V>, defined after the map
+    template<typename K, typename V = void, typename Hasher = Hash<typename PairTraits<K, V>::Key>> class HashMapSnapshot;
+
+    //immutable map with a perfect hash built from a HashMap<K, V>, defined after the map
+    template<typename K, typename V = void, typename Hasher = Hash<typename PairTraits<K, V>::Key>> class FrozenHashMap;
+
+
+    //HashMap<K, V> class definition
+    //it maps keys of type K to values of type V, HashMap<T> is the original map of std::string keys to values of type T.
+    //the pairs are kept in a dense array in insertion order, like the compact dict of CPython, and the
+    //Table storage policy, either ChainedTable (the default) or FlatTable, only stores their indexes.
+    //a removed pair leaves an empty entry that is dropped when the array is compacted, so removing is O(1)
+    //and enumerating the keys or the pairs is a scan of contiguous memory.
+    //the references to the values and the pairs are invalidated by the following insertions and removals
+    template<typename K, typename V = void, typename Hasher = Hash<typename PairTraits<K, V>::Key>, template<typename> class Table = ChainedTable> class HashMap final {
+        public:
+            using Key = typename PairTraits<K, V>::Key;
+            using Value = typename PairTraits<K, V>::Value;
+
+            //type of the keys received by the lookups, std::string keys are looked up through a std::string_view
+            using LookupKey = std::conditional_t<std::is_same_v<Key, std::string>, std::string_view, const Key&>;
+
+
+        private:
+            //element of the dense array: a pair and the full hash value of its key, that is compared
+            //before the keys and reused when the table rehashes
+            class Entry final {
+                public:
+                    Pair<K, V> pair;
+                    std::uint64_t hashValue;
+
+
+                    template<typename... Args> Entry(std::uint64_t, Args&&...);
+            };
+
+
+            //functor used by the table to get the hash value of the entry at an index when it rehashes
+            class IndexHasher final {
+                private:
+                    const std::vector<std::optional<Entry>>* entries;
+
+
+                public:
+                    std::uint64_t operator()(std::uint32_t) const noexcept;
+
+
+                    explicit IndexHasher(const std::vector<std::optional<Entry>>*) noexcept;
+            };
+
+
+            //minimum number of removed entries before the array is compacted
+            static constexpr std::size_t minimumCompaction = 16;
+
+
+
+
+            std::vector<std::optional<Entry>> entries;
+            Table<std::uint32_t> table;
+            Hasher hasher;
+            std::optional<CountingBloomFilter> filter;
+
+
+            static std::uint64_t calculateHashValue(const Hasher&, LookupKey);
+            Pair<K, V>* findPair(std::uint64_t, LookupKey);
+            const Pair<K, V>* findPair(std::uint64_t, LookupKey) const;
+            Pair<K, V>* probePair(std::uint64_t, LookupKey);
+            template<typename... Args> Entry& insertEntry(std::uint64_t, Args&&...);
+            bool erasePair(std::uint64_t, LookupKey);
+            template<typename KeyLike, typename Visitor> int findMany(const KeyLike*, std::size_t, std::uint64_t*, Visitor&&);
+            void rehashStep(void);
+            void compact(void);
+            void rebuildFilter(std::size_t);
+
+
+            //the concurrent map keeps a HashMap for every shard and calls the methods that receive the hash value
+            template<typename, typename, typename, template<typename> class> friend class ConcurrentHashMap;
+
+            //the snapshot writes the entries of the map and hashes its keys like the map
+            template<typename, typename, typename> friend class HashMapSnapshot;
+            template<typename, typename, typename> friend class FrozenHashMap;
+
+
+        public:
+            //forward iterator over the pairs in insertion order, it skips the removed entries and
+            //gives a std::pair of references to the key and the value of the pair it points to
+            class Iterator final {
+                private:
+                    std::optional<Entry>* entry;
+                    std::optional<Entry>* last;
+
+
+                    Iterator(std::optional<Entry>*, std::optional<Entry>*) noexcept;
+
+                    friend class HashMap<K, V, Hasher, Table>;
+
+
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::pair<const Key&, Value&>;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = std::pair<const Key&, Value&>;
+
+
+                    std::pair<const Key&, Value&> operator*(void) const noexcept;
+                    Iterator& operator++(void) noexcept;
+                    Iterator operator++(int) noexcept;
+                    bool operator==(const Iterator&) const noexcept;
+                    bool operator!=(const Iterator&) const noexcept;
+
+
+                    Iterator(void) noexcept;
+            };
+
+
+            void add(const Pair<K, V>&);
+            void add(Pair<K, V>&&);
+            template<typename... Args> Value& emplace(Key, Args&&...);
+            template<typename... Args> std::pair<Value*, bool> tryEmplace(Key, Args&&...);
+            template<typename M> std::pair<Value*, bool> insertOrAssign(Key, M&&);
+            void remove(LookupKey);
+            bool erase(LookupKey);
+            Value& operator[](LookupKey);
+            Value* find(LookupKey);
+            bool exist(LookupKey);
+            template<typename KeyLike> int getMany(const KeyLike*, std::size_t, Value**, std::uint64_t*);
+            template<typename KeyLike> int existMany(const KeyLike*, std::size_t, std::uint64_t*);
+            void reserve(int);
+            int getLength(void) const noexcept;
+            int getBucketNumber(void) const noexcept;
+            float getLoadFactor(void) const noexcept;
+            void setMaxLoadFactor(float);
+            void enableFilter(void);
+            void disableFilter(void);
+            const CountingBloomFilter* getFilter(void) const noexcept;
+            void saveSnapshot(const std::string&) const;
+            static HashMapSnapshot<K, V, Hasher> openSnapshot(const std::string&);
+            FrozenHashMap<K, V, Hasher> freeze(void) const;
+            std::string toString(void);
+            std::string toString(Modality::Association);
+            std::vector<Key> getKeys(void);
+            std::vector<Pair<K, V>*> getPairs(void);
+            Iterator begin(void) noexcept;
+            Iterator end(void) noexcept;
+            template<typename Visitor> void forEach(Visitor&&);
+
+
+            HashMap(int, const Hasher& = Hasher());
+            HashMap(void);
+            explicit HashMap(const HashMapSnapshot<K, V, Hasher>&);
+    };
+
+
+
+
+
+
+    //HASHMAP
+    //CONSTRUCTOR
+    //bucketNumber is the initial number of buckets, rounded up to a power of two
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::HashMap(int bucketNumber, const Hasher& hasher): table(bucketNumber > 0 ? bucketNumber : 1), hasher(hasher) {}
+
+    //CONSTRUCTOR
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::HashMap(): HashMap(16) {}
+
+    //CONSTRUCTOR
+    //promotes a snapshot to a mutable map, the pairs are copied in insertion order with their saved hash values
+    //so no key is hashed again. the indexes of the slots must name every pair exactly once and every key must be
+    //inside the file and appear once, otherwise the file is damaged
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::HashMap(const HashMapSnapshot<K, V, Hasher>& snapshot): HashMap(16, snapshot.hasher) {
+        const std::uint64_t length = snapshot.header->length;
+        const auto* slots = snapshot.getSlots();
+        std::vector<std::uint64_t> hashValues(length);
+        std::vector<bool> found(length, false);
+
+        for(std::uint64_t i = 0; i < length; i++) {
+            const std::uint64_t index = slots[i].index;
+
+            if(index >= length || found[index]) throw std::runtime_error("The snapshot of the HashMap<T> is damaged!");
+
+            found[index] = true;
+            hashValues[index] = slots[i].hashValue;
+        }
+
+
+        reserve(static_cast<int>(length));
+
+        for(std::uint64_t i = 0; i < length; i++) {
+            if(!snapshot.hasValidKey(i) || probePair(hashValues[i], snapshot.readKey(i))) throw std::runtime_error("The snapshot of the HashMap<T> is damaged!");
+
+            insertEntry(hashValues[i], Key(snapshot.readKey(i)), snapshot.readValue(i));
+        }
+    }
+
+
+
+
+    //METHODS
+    //it calculates the hash value of the key passed by argument with the specified hasher. the hasher is called
+    //through a const reference because the readers of a ConcurrentHashMap and of a snapshot share it without a lock
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::uint64_t HashMap<K, V, Hasher, Table>::calculateHashValue(const Hasher& hasher, LookupKey key) {
+        static_assert(std::is_invocable_v<const Hasher&, const Key&>, "The hasher of a HashMap<K, V> must be callable on a const object!");
+
+        //a custom hasher of std::string keys that doesn't accept a std::string_view receives a copy of the key
+        if constexpr(!std::is_same_v<Key, std::string> || std::is_invocable_v<const Hasher&, std::string_view>)
+            return static_cast<std::uint64_t>(hasher(key));
+        else
+            return static_cast<std::uint64_t>(hasher(std::string(key)));
+    }
+
+    //returns the pair with the specified key or nullptr if it doesn't exist.
+    //the filter, if enabled, rejects most of the missing keys before the table is read.
+    //the cached hash values are compared first, so the keys are compared only when the hashes match
+    template<typename K, typename V, typename Hasher, template<typename> class Table> Pair<K, V>* HashMap<K, V, Hasher, Table>::findPair(std::uint64_t hashValue, LookupKey key) {
+        if(filter && !filter->test(hashValue)) return nullptr;
+
+
+        std::uint32_t* index = table.find(hashValue, [this, hashValue, &key](std::uint32_t index) {
+            return entries[index]->hashValue == hashValue && entries[index]->pair.getKey() == key;
+        });
+
+        if(!index) {
+            if(filter) filter->recordFalsePositive();
+            return nullptr;
+        }
+
+        return &entries[*index]->pair;
+    }
+
+    //returns the pair with the specified key or nullptr if it doesn't exist, without modifying the map
+    //nor the statistics of the filter. looking up a pair never modifies the table, so it can be done
+    //at the same time by many readers
+    template<typename K, typename V, typename Hasher, template<typename> class Table> const Pair<K, V>* HashMap<K, V, Hasher, Table>::findPair(std::uint64_t hashValue, LookupKey key) const {
+        if(filter && !filter->mayContain(hashValue)) return nullptr;
+
+
+        const std::uint32_t* index = const_cast<Table<std::uint32_t>&>(table).find(hashValue, [this, hashValue, &key](std::uint32_t index) {
+            return entries[index]->hashValue == hashValue && entries[index]->pair.getKey() == key;
+        });
+
+        return index ? &entries[*index]->pair : nullptr;
+    }
+
+    //returns the pair with the specified key or nullptr like findPair(), but the filter isn't asked to count the
+    //lookup: the insertions use it, so that only the lookups of the user appear in the statistics of the filter
+    template<typename K, typename V, typename Hasher, template<typename> class Table> Pair<K, V>* HashMap<K, V, Hasher, Table>::probePair(std::uint64_t hashValue, LookupKey key) {
+        return const_cast<Pair<K, V>*>(std::as_const(*this).findPair(hashValue, key));
+    }
+
+    //appends an entry to the dense array and stores its index in the table, the key must not be already in the map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename... Args> typename HashMap<K, V, Hasher, Table>::Entry& HashMap<K, V, Hasher, Table>::insertEntry(std::uint64_t hashValue, Args&&... args) {
+        if(entries.size() >= 0xFFFFFFFFu) throw std::runtime_error("The HashMap<T> cannot hold more pairs!");
+
+
+        table.grow(IndexHasher(&entries));
+        entries.emplace_back(std::in_place, hashValue, std::forward<Args>(args)...);
+
+        try {
+            table.insert(hashValue, static_cast<std::uint32_t>(entries.size() - 1));
+        }
+        catch(...) {
+            entries.pop_back();
+            throw;
+        }
+
+
+        if(filter) {
+            if(table.getLength() > filter->getCapacity()) rebuildFilter(table.getLength() * 2);
+            else filter->add(hashValue);
+        }
+
+        return *entries.back();
+    }
+
+    //moves the entries over the empty ones, keeping their order, and updates the indexes stored in the table
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::compact() {
+        std::vector<std::uint32_t> newIndexes(entries.size());
+        std::size_t entryNumber = 0;
+
+        for(std::size_t i = 0; i < entries.size(); i++) {
+            if(!entries[i]) continue;
+
+
+            if(i != entryNumber) entries[entryNumber].emplace(std::move(*entries[i]));
+
+            newIndexes[i] = static_cast<std::uint32_t>(entryNumber++);
+        }
+
+        entries.resize(entryNumber);
+
+
+        table.forEach([&newIndexes](std::uint32_t& index) { index = newIndexes[index]; });
+    }
+
+    //adds a Pair to the hash map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::add(const Pair<K, V>& pair) {
+        add(Pair<K, V>(pair));
+    }
+
+    //adds a Pair to the hash map moving its key and value
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::add(Pair<K, V>&& pair) {
+        rehashStep();
+
+        const std::uint64_t hashValue = calculateHashValue(hasher, pair.getKey());
+
+        if(probePair(hashValue, pair.getKey())) throw std::runtime_error("A pair with the key \"" + Pair<K, V>::keyToString(pair.getKey()) + "\" already exist!");
+
+
+        insertEntry(hashValue, std::move(pair));
+    }
+
+    //constructs the value associated with a key in place and returns its reference
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename... Args> typename HashMap<K, V, Hasher, Table>::Value& HashMap<K, V, Hasher, Table>::emplace(Key key, Args&&... args) {
+        rehashStep();
+
+        const std::uint64_t hashValue = calculateHashValue(hasher, key);
+
+        if(probePair(hashValue, key)) throw std::runtime_error("A pair with the key \"" + Pair<K, V>::keyToString(key) + "\" already exist!");
+
+
+        return insertEntry(hashValue, std::move(key), std::in_place, std::forward<Args>(args)...).pair.getValue();
+    }
+
+    //removes the pair with the specified key leaving an empty entry in its place, returns false if it doesn't exist.
+    //the empty entries at the end of the array are dropped at once, the others when they're more than the pairs
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool HashMap<K, V, Hasher, Table>::erasePair(std::uint64_t hashValue, LookupKey key) {
+        std::uint32_t removedIndex = 0;
+
+        bool removed = table.erase(hashValue, [this, hashValue, &key, &removedIndex](std::uint32_t index) {
+            if(entries[index]->hashValue != hashValue || entries[index]->pair.getKey() != key) return false;
+
+            removedIndex = index;
+            return true;
+        });
+
+        if(!removed) return false;
+
+
+        if(filter) filter->remove(hashValue);
+
+        entries[removedIndex].reset();
+
+        while(!entries.empty() && !entries.back()) entries.pop_back();
+
+
+        std::size_t removedNumber = entries.size() - table.getLength();
+
+        if(removedNumber >= minimumCompaction && removedNumber > table.getLength()) compact();
+
+        return true;
+    }
+
+    //sizes the filter for the specified number of keys and adds to it the cached hash of every pair
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::rebuildFilter(std::size_t capacity) {
+        filter->resize(capacity);
+
+        for(std::optional<Entry>& entry : entries) {
+            if(entry) filter->add(entry->hashValue);
+        }
+    }
+
+    //moves a few buckets forward if the table is rehashing
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::rehashStep() {
+        table.step(IndexHasher(&entries));
+    }
+
+    //constructs the value associated with a key in place only if the key doesn't exist, without throwing.
+    //it returns the pointer to the value associated with the key and true if it has been constructed
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename... Args> std::pair<typename HashMap<K, V, Hasher, Table>::Value*, bool> HashMap<K, V, Hasher, Table>::tryEmplace(Key key, Args&&... args) {
+        rehashStep();
+
+        const std::uint64_t hashValue = calculateHashValue(hasher, key);
+
+        if(Pair<K, V>* pair = probePair(hashValue, key)) return {&pair->getValue(), false};
+
+
+        return {&insertEntry(hashValue, std::move(key), std::in_place, std::forward<Args>(args)...).pair.getValue(), true};
+    }
+
+    //assigns the value to the key, adding the pair if it doesn't exist.
+    //it returns the pointer to the value associated with the key and true if the pair has been added
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename M> std::pair<typename HashMap<K, V, Hasher, Table>::Value*, bool> HashMap<K, V, Hasher, Table>::insertOrAssign(Key key, M&& value) {
+        rehashStep();
+
+        const std::uint64_t hashValue = calculateHashValue(hasher, key);
+
+        if(Pair<K, V>* pair = probePair(hashValue, key)) {
+            pair->getValue() = std::forward<M>(value);
+            return {&pair->getValue(), false};
+        }
+
+
+        return {&insertEntry(hashValue, std::move(key), std::in_place, std::forward<M>(value)).pair.getValue(), true};
+    }
+
+    //removes a Pair from the hash map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::remove(LookupKey key) {
+        if(!erase(key)) throw std::runtime_error("The Pair<T> you're trying to remove doesn't exist!");
+    }
+
+    //removes the pair with the specified key without throwing, it returns false if it doesn't exist
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool HashMap<K, V, Hasher, Table>::erase(LookupKey key) {
+        rehashStep();
+
+        return erasePair(calculateHashValue(hasher, key), key);
+    }
+
+    //returns a modifiable reference to the value associated with the specified key
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Value& HashMap<K, V, Hasher, Table>::operator[](LookupKey key) {
+        rehashStep();
+
+        Pair<K, V>* pair = findPair(calculateHashValue(hasher, key), key);
+
+        if(!pair) throw std::runtime_error("There is no value associated with the key \"" + Pair<K, V>::keyToString(key) + "\" in the HashMap<T>!");
+
+        return pair->getValue();
+    }
+
+    //returns the pointer to the value associated with the specified key, or nullptr if it doesn't exist
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Value* HashMap<K, V, Hasher, Table>::find(LookupKey key) {
+        rehashStep();
+
+        Pair<K, V>* pair = findPair(calculateHashValue(hasher, key), key);
+
+        return pair ? &pair->getValue() : nullptr;
+    }
+
+    //checks if a key exist in the hash map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool HashMap<K, V, Hasher, Table>::exist(LookupKey key) {
+        rehashStep();
+
+        return findPair(calculateHashValue(hasher, key), key) != nullptr;
+    }
+
+    //looks up count keys and calls the visitor with the index of every key and its pair, or nullptr if it doesn't exist.
+    //the keys are resolved a block at a time in stages: first all the buckets are prefetched, then the first element
+    //of every bucket and then the entry it points to, so that the cache misses of different keys overlap.
+    //the i-th bit of misses is set for every missing key. it returns the number of keys found.
+    //the keys can be of any type convertible to LookupKey, so std::string keys can be looked up from an array of
+    //std::string_view without copies. the pairs are found by the const lookup, which leaves the filter statistics alone
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename KeyLike, typename Visitor> int HashMap<K, V, Hasher, Table>::findMany(const KeyLike* keys, std::size_t count, std::uint64_t* misses, Visitor&& visitor) {
+        static_assert(std::is_convertible_v<const KeyLike&, LookupKey>, "The keys have to be convertible to HashMap<K, V>::LookupKey");
+
+        constexpr std::size_t blockSize = 16;
+
+        rehashStep();
+        std::fill(misses, misses + (count + 63) / 64, 0);
+
+
+        int foundNumber = 0;
+        std::uint64_t hashValues[blockSize];
+        const std::uint32_t* candidates[blockSize];
+
+        for(std::size_t first = 0; first < count; first += blockSize) {
+            std::size_t blockLength = std::min(blockSize, count - first);
+
+            for(std::size_t i = 0; i < blockLength; i++) {
+                hashValues[i] = calculateHashValue(hasher, keys[first + i]);
+                table.prefetch(hashValues[i]);
+            }
+
+            for(std::size_t i = 0; i < blockLength; i++) {
+                candidates[i] = table.findCandidate(hashValues[i]);
+                if(candidates[i]) prefetchAddress(candidates[i]);
+            }
+
+            for(std::size_t i = 0; i < blockLength; i++) {
+                if(candidates[i]) prefetchAddress(&entries[*candidates[i]]);
+            }
+
+            for(std::size_t i = 0; i < blockLength; i++) {
+                Pair<K, V>* pair = const_cast<Pair<K, V>*>(std::as_const(*this).findPair(hashValues[i], keys[first + i]));
+
+                if(pair) foundNumber++;
+                else misses[(first + i) / 64] |= std::uint64_t(1) << ((first + i) % 64);
+
+                visitor(first + i, pair);
+            }
+        }
+
+
+        return foundNumber;
+    }
+
+    //looks up count keys at once: values[i] points to the value of keys[i], or is nullptr if the key doesn't exist,
+    //and the i-th bit of misses is set for every missing key, so misses needs (count + 63) / 64 words.
+    //it returns the number of keys found
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename KeyLike> int HashMap<K, V, Hasher, Table>::getMany(const KeyLike* keys, std::size_t count, Value** values, std::uint64_t* misses) {
+        return findMany(keys, count, misses, [values](std::size_t index, Pair<K, V>* pair) { values[index] = pair ? &pair->getValue() : nullptr; });
+    }
+
+    //checks count keys at once like getMany(), the i-th bit of misses is set if keys[i] doesn't exist.
+    //it returns the number of keys found
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename KeyLike> int HashMap<K, V, Hasher, Table>::existMany(const KeyLike* keys, std::size_t count, std::uint64_t* misses) {
+        return findMany(keys, count, misses, [](std::size_t, Pair<K, V>*) {});
+    }
+
+    //grows the table once so that the specified number of pairs fits without any further rehash
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::reserve(int pairNumber) {
+        if(pairNumber <= 0) return;
+
+
+        entries.reserve(pairNumber);
+        table.reserve(pairNumber, IndexHasher(&entries));
+    }
+
+    //returns the number of pairs in the hash map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> int HashMap<K, V, Hasher, Table>::getLength() const noexcept {
+        return static_cast<int>(table.getLength());
+    }
+
+    //returns the number of buckets (or slots) of the table
+    template<typename K, typename V, typename Hasher, template<typename> class Table> int HashMap<K, V, Hasher, Table>::getBucketNumber() const noexcept {
+        return static_cast<int>(table.getBucketNumber());
+    }
+
+    //returns the average number of pairs per bucket
+    template<typename K, typename V, typename Hasher, template<typename> class Table> float HashMap<K, V, Hasher, Table>::getLoadFactor() const noexcept {
+        return table.getLoadFactor();
+    }
+
+    //sets the load factor over which the table grows
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::setMaxLoadFactor(float maxLoadFactor) {
+        table.setMaxLoadFactor(maxLoadFactor);
+    }
+
+    //keeps a counting Bloom filter of the keys in front of the table, so that most lookups of missing keys
+    //return without reading it. the filter costs about 6 bytes per pair and it's resized when the map grows.
+    //it pays off when a miss in the table is expensive, as with the ChainedTable, not with the FlatTable
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::enableFilter() {
+        if(filter) return;
+
+
+        filter.emplace(table.getLength() * 2);
+        rebuildFilter(filter->getCapacity());
+    }
+
+    //removes the filter of the keys
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::disableFilter() {
+        filter.reset();
+    }
+
+    //returns the filter of the keys with its statistics, or nullptr if it isn't enabled
+    template<typename K, typename V, typename Hasher, template<typename> class Table> const CountingBloomFilter* HashMap<K, V, Hasher, Table>::getFilter() const noexcept {
+        return filter ? &*filter : nullptr;
+    }
+
+    //saves the pairs to a file that can be opened by openSnapshot(), the keys must be std::string or
+    //trivially copyable and the values trivially copyable
+    template<typename K, typename V, typename Hasher, template<typename> class Table> void HashMap<K, V, Hasher, Table>::saveSnapshot(const std::string& path) const {
+        HashMapSnapshot<K, V, Hasher>::save(path, *this);
+    }
+
+    //maps a file saved by saveSnapshot(), the snapshot answers the lookups without building a map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMapSnapshot<K, V, Hasher> HashMap<K, V, Hasher, Table>::openSnapshot(const std::string& path) {
+        return HashMapSnapshot<K, V, Hasher>(path);
+    }
+
+    //returns an immutable copy of the map whose lookups use a minimal perfect hash of its keys
+    template<typename K, typename V, typename Hasher, template<typename> class Table> FrozenHashMap<K, V, Hasher> HashMap<K, V, Hasher, Table>::freeze() const {
+        return FrozenHashMap<K, V, Hasher>(*this);
+    }
+
+    //returns the std::string represents the hash map with the association key: value
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::string HashMap<K, V, Hasher, Table>::toString() {
+        std::string stringFormat = "{\n";
+
+        for(std::optional<Entry>& entry : entries) {
+            if(entry) stringFormat += entry->pair.toString();
+        }
+
+
+        stringFormat += "}\n";
+
+        return stringFormat;
+    }
+
+    //returns the string representing the hash map with the specified association
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::string HashMap<K, V, Hasher, Table>::toString(Modality::Association association) {
+        if(association == Modality::Association::keyValue) {
+            return this->toString();
+        }
+        else {
+            std::string stringFormat = "{\n";
+
+            for(std::optional<Entry>& entry : entries) {
+                if(entry) stringFormat += entry->pair.toString(association);
+            }
+
+
+            stringFormat += "\n}";
+            return stringFormat;
+        }
+    }
+
+    //returns a vector of the keys of the hash map in insertion order
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::vector<typename HashMap<K, V, Hasher, Table>::Key> HashMap<K, V, Hasher, Table>::getKeys() {
+        std::vector<Key> keysVector;
+        keysVector.reserve(table.getLength());
+
+        for(std::optional<Entry>& entry : entries) {
+            if(entry) keysVector.push_back(entry->pair.getKey());
+        }
+
+
+
+        return keysVector;
+    }
+
+    //returns the reference of all the pairs in the hash map in insertion order
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::vector<Pair<K, V>*> HashMap<K, V, Hasher, Table>::getPairs() {
+        std::vector<Pair<K, V>*> pairs;
+        pairs.reserve(table.getLength());
+
+        for(std::optional<Entry>& entry : entries) {
+            if(entry) pairs.push_back(&entry->pair);
+        }
+
+
+        return pairs;
+    }
+
+    //returns an iterator to the first pair in insertion order
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Iterator HashMap<K, V, Hasher, Table>::begin() noexcept {
+        return Iterator(entries.data(), entries.data() + entries.size());
+    }
+
+    //returns the past-the-end iterator of the hash map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Iterator HashMap<K, V, Hasher, Table>::end() noexcept {
+        std::optional<Entry>* last = entries.data() + entries.size();
+
+        return Iterator(last, last);
+    }
+
+    //calls the visitor with the key and a modifiable reference to the value of every pair in insertion order,
+    //without allocating. the visitor must not add or remove pairs
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename Visitor> void HashMap<K, V, Hasher, Table>::forEach(Visitor&& visitor) {
+        for(std::optional<Entry>& entry : entries) {
+            if(entry) visitor(static_cast<const Key&>(entry->pair.getKey()), entry->pair.getValue());
+        }
+    }
+
+
+
+
+
+
+
+
+
+    //ENTRY
+    //CONSTRUCTOR
+    //the arguments that follow the hash value construct the pair
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename... Args> HashMap<K, V, Hasher, Table>::Entry::Entry(std::uint64_t hashValue, Args&&... args): pair(std::forward<Args>(args)...), hashValue(hashValue) {}
+
+
+
+
+
+
+
+
+
+    //INDEXHASHER
+    //CONSTRUCTOR
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::IndexHasher::IndexHasher(const std::vector<std::optional<Entry>>* entries) noexcept: entries(entries) {}
+
+
+
+
+    //METHODS
+    //returns the hash value cached in the entry at an index, so that rehashing never hashes the keys again
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::uint64_t HashMap<K, V, Hasher, Table>::IndexHasher::operator()(std::uint32_t index) const noexcept {
+        return (*entries)[index]->hashValue;
+    }
+
+
+
+
+
+
+
+
+
+    //ITERATOR
+    //CONSTRUCTOR
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::Iterator::Iterator() noexcept: entry(nullptr), last(nullptr) {}
+
+    //CONSTRUCTOR
+    //the iterator is moved forward to the first entry that holds a pair
+    template<typename K, typename V, typename Hasher, template<typename> class Table> HashMap<K, V, Hasher, Table>::Iterator::Iterator(std::optional<Entry>* entry, std::optional<Entry>* last) noexcept: entry(entry), last(last) {
+        while(this->entry != last && !*this->entry) this->entry++;
+    }
+
+
+
+
+    //METHODS
+    //returns the key and the value of the pair the iterator points to
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::pair<const typename HashMap<K, V, Hasher, Table>::Key&, typename HashMap<K, V, Hasher, Table>::Value&> HashMap<K, V, Hasher, Table>::Iterator::operator*() const noexcept {
+        return {(*entry)->pair.getKey(), (*entry)->pair.getValue()};
+    }
+
+    //moves to the next entry that holds a pair
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Iterator& HashMap<K, V, Hasher, Table>::Iterator::operator++() noexcept {
+        do entry++; while(entry != last && !*entry);
+
+        return *this;
+    }
+
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename HashMap<K, V, Hasher, Table>::Iterator HashMap<K, V, Hasher, Table>::Iterator::operator++(int) noexcept {
+        Iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool HashMap<K, V, Hasher, Table>::Iterator::operator==(const Iterator& other) const noexcept {
+        return entry == other.entry;
+    }
+
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool HashMap<K, V, Hasher, Table>::Iterator::operator!=(const Iterator& other) const noexcept {
+        return entry != other.entry;
+    }
+
+
+
+
+
+
+
+
+
+    //CHAINEDTABLE
+    //CONSTRUCTOR
+    //bucketNumber is rounded up to the next power of two
+    template<typename E> ChainedTable<E>::ChainedTable(std::size_t bucketNumber): rehashIndex(0), freeNode(nullNode), length(0), maxLoadFactor(1.0f) {
+        std::size_t roundedBucketNumber = 1;
+        while(roundedBucketNumber < bucketNumber) roundedBucketNumber <<= 1;
+
+        hashTable.assign(roundedBucketNumber, nullNode);
+    }
+
+    //MOVE CONSTRUCTOR
+    //the moved table is left without buckets, it creates them again on the next insertion
+    template<typename E> ChainedTable<E>::ChainedTable(ChainedTable<E>&& other) noexcept: nodes(std::move(other.nodes)), hashTable(std::move(other.hashTable)), oldHashTable(std::move(other.oldHashTable)), rehashIndex(other.rehashIndex), freeNode(other.freeNode), length(other.length), maxLoadFactor(other.maxLoadFactor) {
+        other.rehashIndex = 0;
+        other.freeNode = nullNode;
+        other.length = 0;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename E> ChainedTable<E>& ChainedTable<E>::operator=(ChainedTable<E>&& other) noexcept {
+        if(this != &other) {
+            nodes = std::move(other.nodes);
+            hashTable = std::move(other.hashTable);
+            oldHashTable = std::move(other.oldHashTable);
+            rehashIndex = other.rehashIndex;
+            freeNode = other.freeNode;
+            length = other.length;
+            maxLoadFactor = other.maxLoadFactor;
+
+            other.nodes.clear();
+            other.hashTable.clear();
+            other.oldHashTable.clear();
+            other.rehashIndex = 0;
+            other.freeNode = nullNode;
+            other.length = 0;
+        }
+
+        return *this;
+    }
+
+
+
+
+    //METHODS
+    //returns the first node of the bucket that holds the elements with the specified hash value.
+    //while rehashing, the elements of an old bucket that hasn't been moved yet are still in the old table
+    template<typename E> std::uint32_t& ChainedTable<E>::findBucket(std::uint64_t hashValue) {
+        if(!oldHashTable.empty()) {
+            std::size_t index = hashValue & (oldHashTable.size() - 1);
+
+            if(index >= rehashIndex) return oldHashTable[index];
+        }
+
+
+        return hashTable[hashValue & (hashTable.size() - 1)];
+    }
+
+    //replaces the table with an empty one of the specified size, the old table is kept until all its
+    //buckets are moved. an empty bucket is a single index so the new table is filled with a memset
+    template<typename E> template<typename HashOf> void ChainedTable<E>::startRehash(std::size_t bucketNumber, HashOf& hashOf) {
+        while(!oldHashTable.empty()) step(hashOf);
+
+        oldHashTable = std::move(hashTable);
+        hashTable.assign(bucketNumber, nullNode);
+        rehashIndex = 0;
+    }
+
+    //returns the element recognized by match among the ones with the specified hash value, nullptr if there is none
+    template<typename E> template<typename Match> E* ChainedTable<E>::find(std::uint64_t hashValue, Match&& match) {
+        if(hashTable.empty()) return nullptr;
+
+
+        for(std::uint32_t index = findBucket(hashValue); index != nullNode; index = nodes[index].next) {
+            if(match(nodes[index].element)) return &nodes[index].element;
+        }
+
+        return nullptr;
+    }
+
+    //constructs an element at the front of its bucket, the element must not be already in the table
+    template<typename E> template<typename... Args> E& ChainedTable<E>::insert(std::uint64_t hashValue, Args&&... args) {
+        std::uint32_t index;
+
+        if(freeNode != nullNode) {
+            index = freeNode;
+            nodes[index].element = E(std::forward<Args>(args)...);
+            freeNode = nodes[index].next;
+        }
+        else {
+            if(nodes.size() >= nullNode) throw std::runtime_error("The ChainedTable<E> cannot hold more elements!");
+
+            index = static_cast<std::uint32_t>(nodes.size());
+            nodes.push_back(Node{E(std::forward<Args>(args)...), nullNode});
+        }
+
+
+        std::uint32_t& bucket = findBucket(hashValue);
+
+        nodes[index].next = bucket;
+        bucket = index;
+        length++;
+
+        return nodes[index].element;
+    }
+
+    //removes the element recognized by match, returns false if there is none.
+    //the node is put in the list of free nodes and its element is overwritten when it's reused
+    template<typename E> template<typename Match> bool ChainedTable<E>::erase(std::uint64_t hashValue, Match&& match) {
+        if(hashTable.empty()) return false;
+
+
+        for(std::uint32_t* link = &findBucket(hashValue); *link != nullNode; link = &nodes[*link].next) {
+            std::uint32_t index = *link;
+
+            if(match(nodes[index].element)) {
+                *link = nodes[index].next;
+                nodes[index].next = freeNode;
+                freeNode = index;
+                length--;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //moves a few buckets of the old table into the new one.
+    //the nodes are relinked by their index so no element is moved
+    template<typename E> template<typename HashOf> void ChainedTable<E>::step(HashOf&& hashOf) {
+        if(oldHashTable.empty()) return;
+
+
+        std::size_t movedBuckets = 0;
+        std::size_t visitedBuckets = 0;
+
+        while(rehashIndex < oldHashTable.size() && movedBuckets < rehashStepBuckets && visitedBuckets < rehashStepBuckets * 10) {
+            std::uint32_t index = oldHashTable[rehashIndex];
+
+            if(index != nullNode) {
+                while(index != nullNode) {
+                    std::uint32_t next = nodes[index].next;
+                    std::uint32_t& destination = hashTable[hashOf(nodes[index].element) & (hashTable.size() - 1)];
+
+                    nodes[index].next = destination;
+                    destination = index;
+                    index = next;
+                }
+
+                oldHashTable[rehashIndex] = nullNode;
+                movedBuckets++;
+            }
+
+            rehashIndex++;
+            visitedBuckets++;
+        }
+
+
+        if(rehashIndex == oldHashTable.size()) std::vector<std::uint32_t>().swap(oldHashTable);
+    }
+
+    //makes room for one more element, doubling the number of buckets when the load factor would exceed the maximum
+    template<typename E> template<typename HashOf> void ChainedTable<E>::grow(HashOf&& hashOf) {
+        if(hashTable.empty()) hashTable.assign(16, nullNode);
+
+        if(oldHashTable.empty() && length + 1 > hashTable.size() * maxLoadFactor) startRehash(hashTable.size() * 2, hashOf);
+    }
+
+    //rehashes the table once so that the specified number of elements fits without any further rehash
+    template<typename E> template<typename HashOf> void ChainedTable<E>::reserve(std::size_t elementNumber, HashOf&& hashOf) {
+        nodes.reserve(elementNumber);
+
+
+        std::size_t bucketNumber = 1;
+        while(bucketNumber * maxLoadFactor < elementNumber) bucketNumber <<= 1;
+
+        if(bucketNumber <= hashTable.size()) return;
+
+
+        startRehash(bucketNumber, hashOf);
+        while(!oldHashTable.empty()) step(hashOf);
+    }
+
+    //calls the visitor on every element of the table
+    template<typename E> template<typename Visitor> void ChainedTable<E>::forEach(Visitor&& visitor) {
+        for(std::vector<std::uint32_t>* table : {&oldHashTable, &hashTable}) {
+            for(std::uint32_t bucket : *table) {
+                for(std::uint32_t index = bucket; index != nullNode; index = nodes[index].next) visitor(nodes[index].element);
+            }
+        }
+    }
+
+    //prefetches the bucket of a hash value before it's looked up
+    template<typename E> void ChainedTable<E>::prefetch(std::uint64_t hashValue) const noexcept {
+        if(hashTable.empty()) return;
+
+
+        prefetchAddress(&hashTable[hashValue & (hashTable.size() - 1)]);
+
+        if(!oldHashTable.empty()) prefetchAddress(&oldHashTable[hashValue & (oldHashTable.size() - 1)]);
+    }
+
+    //returns the first element of the bucket of a hash value, or nullptr if it's empty.
+    //it's used to prefetch the data that will be read to compare the element
+    template<typename E> const E* ChainedTable<E>::findCandidate(std::uint64_t hashValue) const noexcept {
+        if(hashTable.empty()) return nullptr;
+
+
+        std::uint32_t index = const_cast<ChainedTable<E>*>(this)->findBucket(hashValue);
+
+        return index != nullNode ? &nodes[index].element : nullptr;
+    }
+
+    //returns the number of elements in the table
+    template<typename E> std::size_t ChainedTable<E>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //returns the number of buckets of the current table
+    template<typename E> std::size_t ChainedTable<E>::getBucketNumber() const noexcept {
+        return hashTable.size();
+    }
+
+    //returns the average number of elements per bucket
+    template<typename E> float ChainedTable<E>::getLoadFactor() const noexcept {
+        return hashTable.empty() ? 0.0f : static_cast<float>(length) / hashTable.size();
+    }
+
+    //sets the load factor over which the number of buckets doubles
+    template<typename E> void ChainedTable<E>::setMaxLoadFactor(float maxLoadFactor) {
+        if(maxLoadFactor <= 0) throw std::runtime_error("The maximum load factor of a ChainedTable<E> has to be positive!");
+
+        this->maxLoadFactor = maxLoadFactor;
+    }
+
+
+
+
+
+
+
+
+
+    //FLATTABLE
+    //CONSTRUCTOR
+    //slotNumber is rounded up to a power of two of at least 16 slots
+    template<typename E> FlatTable<E>::FlatTable(std::size_t slotNumber): capacity(0), length(0), deletedNumber(0), maxLoadFactor(0.875f) {
+        std::size_t roundedSlotNumber = groupWidth;
+        while(roundedSlotNumber < slotNumber) roundedSlotNumber <<= 1;
+
+
+        control.reset(new std::int8_t[roundedSlotNumber + groupWidth]);
+        slots.reset(new Slot[roundedSlotNumber]);
+        capacity = roundedSlotNumber;
+
+        std::memset(control.get(), emptyControl, capacity + groupWidth);
+    }
+
+    //COPY CONSTRUCTOR
+    template<typename E> FlatTable<E>::FlatTable(const FlatTable<E>& other): capacity(0), length(0), deletedNumber(0), maxLoadFactor(other.maxLoadFactor) {
+        if(other.capacity == 0) return;
+
+
+        control.reset(new std::int8_t[other.capacity + groupWidth]);
+        slots.reset(new Slot[other.capacity]);
+        capacity = other.capacity;
+
+        std::memset(control.get(), emptyControl, capacity + groupWidth);
+
+
+        //the control bytes are copied one by one so that a throwing copy leaves only constructed slots marked as full
+        for(std::size_t i = 0; i < capacity; i++) {
+            if(other.control[i] >= 0) {
+                new (&slots[i]) E(*std::launder(reinterpret_cast<const E*>(other.slots[i].storage)));
+                setControl(i, other.control[i]);
+                length++;
+            }
+            else if(other.control[i] == deletedControl) {
+                setControl(i, deletedControl);
+                deletedNumber++;
+            }
+        }
+    }
+
+    //MOVE CONSTRUCTOR
+    //the moved table is left without slots, it allocates them again on the next insertion
+    template<typename E> FlatTable<E>::FlatTable(FlatTable<E>&& other) noexcept: control(std::move(other.control)), slots(std::move(other.slots)), capacity(other.capacity), length(other.length), deletedNumber(other.deletedNumber), maxLoadFactor(other.maxLoadFactor) {
+        other.capacity = 0;
+        other.length = 0;
+        other.deletedNumber = 0;
+    }
+
+    //DESTRUCTOR
+    template<typename E> FlatTable<E>::~FlatTable() {
+        destroyElements();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename E> FlatTable<E>& FlatTable<E>::operator=(const FlatTable<E>& other) {
+        if(this != &other) {
+            FlatTable<E> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename E> FlatTable<E>& FlatTable<E>::operator=(FlatTable<E>&& other) noexcept {
+        if(this != &other) {
+            destroyElements();
+
+            control = std::move(other.control);
+            slots = std::move(other.slots);
+            capacity = other.capacity;
+            length = other.length;
+            deletedNumber = other.deletedNumber;
+            maxLoadFactor = other.maxLoadFactor;
+
+            other.capacity = 0;
+            other.length = 0;
+            other.deletedNumber = 0;
+        }
+
+        return *this;
+    }
+
+
+
+
+    //METHODS
+    //returns the element constructed in a slot
+    template<typename E> E& FlatTable<E>::getElement(std::size_t index) noexcept {
+        return *std::launder(reinterpret_cast<E*>(slots[index].storage));
+    }
+
+    //sets the control byte of a slot and its mirror after the end of the array
+    template<typename E> void FlatTable<E>::setControl(std::size_t index, std::int8_t value) noexcept {
+        control[index] = value;
+
+        if(index < groupWidth) control[capacity + index] = value;
+    }
+
+    //destroys every element of the table
+    template<typename E> void FlatTable<E>::destroyElements() noexcept {
+        for(std::size_t i = 0; i < capacity; i++) {
+            if(control[i] >= 0) getElement(i).~E();
+        }
+    }
+
+    //returns the bit mask of the slots of a group whose control byte is equal to value
+    template<typename E> std::uint32_t FlatTable<E>::matchControl(const std::int8_t* group, std::int8_t value) noexcept {
+        #if defined(__SSE2__) || defined(_M_X64)
+            __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(value))));
+        #else
+            std::uint32_t mask = 0;
+
+            for(std::size_t i = 0; i < groupWidth; i++) {
+                if(group[i] == value) mask |= 1u << i;
+            }
+
+            return mask;
+        #endif
+    }
+
+    //returns the bit mask of the slots of a group that are empty or deleted (their control byte is negative)
+    template<typename E> std::uint32_t FlatTable<E>::matchFree(const std::int8_t* group) noexcept {
+        #if defined(__SSE2__) || defined(_M_X64)
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+        #else
+            std::uint32_t mask = 0;
+
+            for(std::size_t i = 0; i < groupWidth; i++) {
+                if(group[i] < 0) mask |= 1u << i;
+            }
+
+            return mask;
+        #endif
+    }
+
+    //returns the first empty or deleted slot of the probe sequence of a hash value.
+    //the groups are probed with triangular steps, that visit every group of a power of two table
+    template<typename E> std::size_t FlatTable<E>::findFreeSlot(std::uint64_t hashValue) const noexcept {
+        const std::size_t mask = capacity - 1;
+        std::size_t position = (hashValue >> 7) & mask;
+
+        for(std::size_t probe = 1; ; probe++) {
+            std::uint32_t freeSlots = matchFree(control.get() + position);
+
+            if(freeSlots) return (position + lowestBit(freeSlots)) & mask;
+
+            position = (position + groupWidth * probe) & mask;
+        }
+    }
+
+    //moves every element into new arrays of the specified capacity, the deleted slots are discarded
+    template<typename E> template<typename HashOf> void FlatTable<E>::rehash(std::size_t newCapacity, HashOf& hashOf) {
+        std::unique_ptr<std::int8_t[]> oldControl = std::move(control);
+        std::unique_ptr<Slot[]> oldSlots = std::move(slots);
+        std::size_t oldCapacity = capacity;
+
+
+        control.reset(new std::int8_t[newCapacity + groupWidth]);
+        slots.reset(new Slot[newCapacity]);
+        capacity = newCapacity;
+        deletedNumber = 0;
+
+        std::memset(control.get(), emptyControl, capacity + groupWidth);
+
+
+        for(std::size_t i = 0; i < oldCapacity; i++) {
+            if(oldControl[i] < 0) continue;
+
+
+            E& element = *std::launder(reinterpret_cast<E*>(oldSlots[i].storage));
+            std::size_t index = findFreeSlot(hashOf(element));
+
+            new (&slots[index]) E(std::move(element));
+            setControl(index, oldControl[i]);
+            element.~E();
+        }
+    }
+
+    //returns the element recognized by match among the ones with the specified hash value, nullptr if there is none.
+    //a group of 16 control bytes is compared with the 7 bits of the hash at once and the probe stops at the
+    //first group that has an empty slot
+    template<typename E> template<typename Match> E* FlatTable<E>::find(std::uint64_t hashValue, Match&& match) {
+        if(capacity == 0) return nullptr;
+
+
+        const std::size_t mask = capacity - 1;
+        const std::int8_t fingerprint = static_cast<std::int8_t>(hashValue & 0x7F);
+        std::size_t position = (hashValue >> 7) & mask;
+
+        for(std::size_t probe = 1; ; probe++) {
+            const std::int8_t* group = control.get() + position;
+
+            for(std::uint32_t candidates = matchControl(group, fingerprint); candidates; candidates &= candidates - 1) {
+                E& element = getElement((position + lowestBit(candidates)) & mask);
+
+                if(match(element)) return &element;
+            }
+
+            if(matchControl(group, emptyControl)) return nullptr;
+
+            position = (position + groupWidth * probe) & mask;
+        }
+    }
+
+    //constructs an element in the first free slot of its probe sequence, the element must not be already in the table
+    //and grow() must have been called before
+    template<typename E> template<typename... Args> E& FlatTable<E>::insert(std::uint64_t hashValue, Args&&... args) {
+        std::size_t index = findFreeSlot(hashValue);
+
+        new (&slots[index]) E(std::forward<Args>(args)...);
+
+        if(control[index] == deletedControl) deletedNumber--;
+        setControl(index, static_cast<std::int8_t>(hashValue & 0x7F));
+        length++;
+
+        return getElement(index);
+    }
+
+    //removes the element recognized by match leaving a deleted slot, returns false if there is none
+    template<typename E> template<typename Match> bool FlatTable<E>::erase(std::uint64_t hashValue, Match&& match) {
+        E* element = find(hashValue, std::forward<Match>(match));
+
+        if(!element) return false;
+
+
+        std::size_t index = reinterpret_cast<Slot*>(element) - slots.get();
+
+        element->~E();
+        setControl(index, deletedControl);
+        length--;
+        deletedNumber++;
+
+        return true;
+    }
+
+    //the flat table has no incremental work to do
+    template<typename E> template<typename HashOf> void FlatTable<E>::step(HashOf&&) {}
+
+    //makes room for one more element. when the full and deleted slots would exceed the maximum load factor
+    //the table is rehashed, in place if removing the deleted slots is enough, or doubling its capacity
+    template<typename E> template<typename HashOf> void FlatTable<E>::grow(HashOf&& hashOf) {
+        if(capacity == 0) {
+            float load = maxLoadFactor;
+
+            *this = FlatTable<E>(groupWidth);
+            maxLoadFactor = load;
+            return;
+        }
+
+        if(length + deletedNumber + 1 <= capacity * maxLoadFactor) return;
+
+
+        if(length + 1 <= capacity * maxLoadFactor / 2) rehash(capacity, hashOf);
+        else rehash(capacity * 2, hashOf);
+    }
+
+    //rehashes the table once so that the specified number of elements fits without any further rehash
+    template<typename E> template<typename HashOf> void FlatTable<E>::reserve(std::size_t elementNumber, HashOf&& hashOf) {
+        std::size_t newCapacity = groupWidth;
+        while(newCapacity * maxLoadFactor < elementNumber + 1) newCapacity <<= 1;
+
+        if(newCapacity > capacity) rehash(newCapacity, hashOf);
+    }
+
+    //calls the visitor on every element of the table, in the order of the slots
+    template<typename E> template<typename Visitor> void FlatTable<E>::forEach(Visitor&& visitor) {
+        for(std::size_t i = 0; i < capacity; i++) {
+            if(control[i] >= 0) visitor(getElement(i));
+        }
+    }
+
+    //prefetches the first group of control bytes and the first slot probed for a hash value
+    template<typename E> void FlatTable<E>::prefetch(std::uint64_t hashValue) const noexcept {
+        if(capacity == 0) return;
+
+
+        std::size_t position = (hashValue >> 7) & (capacity - 1);
+
+        prefetchAddress(control.get() + position);
+        prefetchAddress(&slots[position]);
+    }
+
+    //returns the first element of the first group probed for a hash value whose control byte matches it,
+    //or nullptr if there is none. it's used to prefetch the data that will be read to compare the element
+    template<typename E> const E* FlatTable<E>::findCandidate(std::uint64_t hashValue) const noexcept {
+        if(capacity == 0) return nullptr;
+
+
+        const std::size_t mask = capacity - 1;
+        const std::size_t position = (hashValue >> 7) & mask;
+        std::uint32_t candidates = matchControl(control.get() + position, static_cast<std::int8_t>(hashValue & 0x7F));
+
+        if(!candidates) return nullptr;
+
+        return std::launder(reinterpret_cast<const E*>(slots[(position + lowestBit(candidates)) & mask].storage));
+    }
+
+    //returns the number of elements in the table
+    template<typename E> std::size_t FlatTable<E>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //returns the number of slots of the table
+    template<typename E> std::size_t FlatTable<E>::getBucketNumber() const noexcept {
+        return capacity;
+    }
+
+    //returns the fraction of slots that hold an element
+    template<typename E> float FlatTable<E>::getLoadFactor() const noexcept {
+        return capacity == 0 ? 0.0f : static_cast<float>(length) / capacity;
+    }
+
+    //sets the fraction of full and deleted slots over which the table is rehashed, at least one slot is always left empty
+    template<typename E> void FlatTable<E>::setMaxLoadFactor(float maxLoadFactor) {
+        if(maxLoadFactor <= 0 || maxLoadFactor >= 1) throw std::runtime_error("The maximum load factor of a FlatTable<E> has to be between 0 and 1!");
+
+        this->maxLoadFactor = maxLoadFactor;
+    }
+
+
+
+
+
+
+
+
+
+    //COUNTINGBLOOMFILTER
+    //CONSTRUCTOR
+    //capacity is the number of values the filter is sized for
+    inline CountingBloomFilter::CountingBloomFilter(std::size_t capacity): capacity(0), lookups(0), negatives(0), falsePositives(0) {
+        resize(capacity);
+    }
+
+
+
+
+    //METHODS
+    //returns the block of a hash value. the value is mixed again because the tables use its lowest bits,
+    //then the highest 32 bits select the block and the lowest 28 bits the counters inside it
+    inline CountingBloomFilter::Block& CountingBloomFilter::findBlock(std::uint64_t mixedValue) noexcept {
+        return blocks[((mixedValue >> 32) * blocks.size()) >> 32];
+    }
+
+    inline const CountingBloomFilter::Block& CountingBloomFilter::findBlock(std::uint64_t mixedValue) const noexcept {
+        return blocks[((mixedValue >> 32) * blocks.size()) >> 32];
+    }
+
+    //returns the position of the i-th counter of a mixed hash value inside its block
+    inline unsigned CountingBloomFilter::getPosition(std::uint64_t mixedValue, int i) noexcept {
+        return static_cast<unsigned>((mixedValue >> (7 * i)) & 0x7F);
+    }
+
+    //returns the counter at a position of a block, two counters are packed in every byte
+    inline unsigned CountingBloomFilter::getCounter(const Block& block, unsigned position) noexcept {
+        return (block.counters[position >> 1] >> ((position & 1) * 4)) & 0xF;
+    }
+
+    //sets the counter at a position of a block
+    inline void CountingBloomFilter::setCounter(Block& block, unsigned position, unsigned value) noexcept {
+        const unsigned shift = (position & 1) * 4;
+
+        block.counters[position >> 1] = static_cast<std::uint8_t>((block.counters[position >> 1] & ~(0xF << shift)) | (value << shift));
+    }
+
+    //adds a hash value to the filter
+    inline void CountingBloomFilter::add(std::uint64_t hashValue) noexcept {
+        const std::uint64_t mixedValue = Hash<std::uint64_t>::mixInteger(hashValue);
+        Block& block = findBlock(mixedValue);
+
+        for(int i = 0; i < hashNumber; i++) {
+            unsigned position = getPosition(mixedValue, i);
+            unsigned counter = getCounter(block, position);
+
+            if(counter < 15) setCounter(block, position, counter + 1);
+        }
+    }
+
+    //removes a hash value that has been added to the filter, the saturated counters are left as they are
+    inline void CountingBloomFilter::remove(std::uint64_t hashValue) noexcept {
+        const std::uint64_t mixedValue = Hash<std::uint64_t>::mixInteger(hashValue);
+        Block& block = findBlock(mixedValue);
+
+        for(int i = 0; i < hashNumber; i++) {
+            unsigned position = getPosition(mixedValue, i);
+            unsigned counter = getCounter(block, position);
+
+            if(counter > 0 && counter < 15) setCounter(block, position, counter - 1);
+        }
+    }
+
+    //returns false if the hash value has surely never been added, true if it may have been
+    inline bool CountingBloomFilter::mayContain(std::uint64_t hashValue) const noexcept {
+        const std::uint64_t mixedValue = Hash<std::uint64_t>::mixInteger(hashValue);
+        const Block& block = findBlock(mixedValue);
+
+        for(int i = 0; i < hashNumber; i++) {
+            if(getCounter(block, getPosition(mixedValue, i)) == 0) return false;
+        }
+
+        return true;
+    }
+
+    //like mayContain(), but it also counts the lookups and the negative answers
+    inline bool CountingBloomFilter::test(std::uint64_t hashValue) noexcept {
+        lookups++;
+
+        if(mayContain(hashValue)) return true;
+
+
+        negatives++;
+        return false;
+    }
+
+    //counts a value that passed the filter but wasn't in the map
+    inline void CountingBloomFilter::recordFalsePositive() noexcept {
+        falsePositives++;
+    }
+
+    //clears the counters and sizes the filter for the specified number of values, the statistics are kept
+    inline void CountingBloomFilter::resize(std::size_t capacity) {
+        this->capacity = std::max<std::size_t>(capacity, 64);
+
+        blocks.assign((this->capacity * countersPerValue + 127) / 128, Block{});
+    }
+
+    //returns the number of values the filter is sized for
+    inline std::size_t CountingBloomFilter::getCapacity() const noexcept {
+        return this->capacity;
+    }
+
+    //returns the number of lookups tested by the filter
+    inline std::uint64_t CountingBloomFilter::getLookups() const noexcept {
+        return this->lookups;
+    }
+
+    //returns the number of lookups rejected by the filter
+    inline std::uint64_t CountingBloomFilter::getNegatives() const noexcept {
+        return this->negatives;
+    }
+
+    //returns the number of lookups that passed the filter for a key that doesn't exist
+    inline std::uint64_t CountingBloomFilter::getFalsePositives() const noexcept {
+        return this->falsePositives;
+    }
+
+    //returns the fraction of the lookups of missing keys that passed the filter
+    inline float CountingBloomFilter::getFalsePositiveRate() const noexcept {
+        const std::uint64_t missingLookups = negatives + falsePositives;
+
+        return missingLookups == 0 ? 0.0f : static_cast<float>(falsePositives) / missingLookups;
+    }
+
+
+
+
+
+
+
+
+
+    //HASH
+    //METHODS
+    //multiplies two words and replaces them with the low and high halves of the 128 bit product
+    inline void Hash<std::string>::multiply(std::uint64_t& a, std::uint64_t& b) noexcept {
+        #if defined(__SIZEOF_INT128__)
+            __uint128_t product = static_cast<__uint128_t>(a) * b;
+            a = static_cast<std::uint64_t>(product);
+            b = static_cast<std::uint64_t>(product >> 64);
+        #else
+            std::uint64_t aHigh = a >> 32, aLow = static_cast<std::uint32_t>(a);
+            std::uint64_t bHigh = b >> 32, bLow = static_cast<std::uint32_t>(b);
+            std::uint64_t high = aHigh * bHigh, middle0 = aHigh * bLow, middle1 = aLow * bHigh, low = aLow * bLow;
+            std::uint64_t t = low + (middle0 << 32);
+            std::uint64_t carry = t < low;
+            std::uint64_t lowResult = t + (middle1 << 32);
+            carry += lowResult < t;
+
+            a = lowResult;
+            b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+        #endif
+    }
+
+    //folds two words into one through their 128 bit product
+    inline std::uint64_t Hash<std::string>::mix(std::uint64_t a, std::uint64_t b) noexcept {
+        multiply(a, b);
+        return a ^ b;
+    }
+
+    //reads 8 unaligned bytes
+    inline std::uint64_t Hash<std::string>::read64(const unsigned char* pointer) noexcept {
+        std::uint64_t word;
+        std::memcpy(&word, pointer, sizeof(word));
+        return word;
+    }
+
+    //reads 4 unaligned bytes
+    inline std::uint64_t Hash<std::string>::read32(const unsigned char* pointer) noexcept {
+        std::uint32_t word;
+        std::memcpy(&word, pointer, sizeof(word));
+        return word;
+    }
+
+    //hashes a sequence of bytes, keys longer than 48 bytes are consumed by three independent lanes
+    inline std::uint64_t Hash<std::string>::hashBytes(const void* key, std::size_t length, std::uint64_t seed) noexcept {
+        const unsigned char* pointer = static_cast<const unsigned char*>(key);
+        std::uint64_t a, b;
+
+        seed ^= mix(seed ^ secret[0], secret[1]);
+
+
+        if(length <= 16) {
+            if(length >= 4) {
+                a = (read32(pointer) << 32) | read32(pointer + ((length >> 3) << 2));
+                b = (read32(pointer + length - 4) << 32) | read32(pointer + length - 4 - ((length >> 3) << 2));
+            }
+            else if(length > 0) {
+                a = (std::uint64_t(pointer[0]) << 16) | (std::uint64_t(pointer[length >> 1]) << 8) | pointer[length - 1];
+                b = 0;
+            }
+            else {
+                a = b = 0;
+            }
+        }
+        else {
+            std::size_t remaining = length;
+
+            if(remaining > 48) {
+                std::uint64_t seed1 = seed, seed2 = seed;
+
+                do {
+                    seed = mix(read64(pointer) ^ secret[1], read64(pointer + 8) ^ seed);
+                    seed1 = mix(read64(pointer + 16) ^ secret[2], read64(pointer + 24) ^ seed1);
+                    seed2 = mix(read64(pointer + 32) ^ secret[3], read64(pointer + 40) ^ seed2);
+                    pointer += 48;
+                    remaining -= 48;
+                } while(remaining > 48);
+
+                seed ^= seed1 ^ seed2;
+            }
+
+            while(remaining > 16) {
+                seed = mix(read64(pointer) ^ secret[1], read64(pointer + 8) ^ seed);
+                pointer += 16;
+                remaining -= 16;
+            }
+
+            a = read64(pointer + remaining - 16);
+            b = read64(pointer + remaining - 8);
+        }
+
+
+        a ^= secret[1];
+        b ^= seed;
+        multiply(a, b);
+
+        return mix(a ^ secret[0] ^ length, b ^ secret[1]);
+    }
+
+    //returns the hash of a string
+    inline std::uint64_t Hash<std::string>::operator()(std::string_view key) const noexcept {
+        return hashBytes(key.data(), key.size());
+    }
+
+    //returns the hash of a key given by std::hash
+    template<typename K, typename Enable> std::uint64_t Hash<K, Enable>::operator()(const K& key) const {
+        return Hash<std::uint64_t>::mixInteger(static_cast<std::uint64_t>(std::hash<K>()(key)));
+    }
+
+    //mixes the bits of a word so that every bit of the input changes about half the bits of the output
+    template<typename K> std::uint64_t Hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>>::mixInteger(std::uint64_t key) noexcept {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ull;
+        key ^= key >> 33;
+
+        return key;
+    }
+
+    //returns the hash of an integral or enum key
+    template<typename K> std::uint64_t Hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>>::operator()(K key) const noexcept {
+        return mixInteger(static_cast<std::uint64_t>(key));
+    }
+
+
+
+
+
+
+
+
+
+    //PAIR
+    //CONSTRUCTOR
+    template<typename K, typename V> Pair<K, V>::Pair(Key key, Value value): key(std::move(key)), value(std::move(value)) {}
+
+    //CONSTRUCTOR
+    //the value is constructed in place from the arguments that follow std::in_place
+    template<typename K, typename V> template<typename... Args> Pair<K, V>::Pair(Key key, std::in_place_t, Args&&... args): key(std::move(key)), value(std::forward<Args>(args)...) {}
+
+
+
+
+    //METHODS
+    //it returns the key of a Pair
+    template<typename K, typename V> const typename Pair<K, V>::Key& Pair<K, V>::getKey() const noexcept {
+        return this->key;
+    }
+
+    //it returns the value of a Pair
+    template<typename K, typename V> typename Pair<K, V>::Value& Pair<K, V>::getValue() noexcept {
+        return this->value;
+    }
+
+    //it sets the value of a Pair
+    template<typename K, typename V> void Pair<K, V>::setValue(const Value& value) {
+        this->value = value;
+    }
+
+    //it sets the value of a Pair moving it
+    template<typename K, typename V> void Pair<K, V>::setValue(Value&& value) {
+        this->value = std::move(value);
+    }
+
+    //returns the string representing a pair with the key: value association
+    template<typename K, typename V> std::string Pair<K, V>::toString() {
+        try {
+            return "\t{\"" + keyToString(this->key) + "\": " + std::to_string(this->value) + "}\n";
+        }
+        catch(...) {
+            return "It's impossible to display a string format of this HashMap<T> because of the type of it's value";
+        }
+    }
+
+    //returns the string representing a pair with the specified association
+    template<typename K, typename V> std::string Pair<K, V>::toString(Modality::Association association) {
+        if(association == Modality::Association::keyValue) {
+            return this->toString();
+        }
+        else {
+            try {
+                return "\t{\"" + std::to_string(this->value) + "\": " + keyToString(this->key) + "}\n";
+            }
+            catch(...) {
+                return "It's impossible to display a string format of this HashMap<T> because of the type of it's value";
+            }
+        }
+    }
+
+    //returns the string representing a key, the keys that are not strings, numbers or enums are represented by "?"
+    template<typename K, typename V> template<typename Other> std::string Pair<K, V>::keyToString(const Other& key) {
+        if constexpr(std::is_convertible_v<const Other&, std::string_view>)
+            return std::string(std::string_view(key));
+        else if constexpr(std::is_arithmetic_v<Other>)
+            return std::to_string(key);
+        else if constexpr(std::is_enum_v<Other>)
+            return std::to_string(static_cast<std::underlying_type_t<Other>>(key));
+        else
+            return "?";
+    }
+    
+    #pragma endregion
+
+    #pragma region CONCURRENTHASHMAP
+    //ConcurrentHashMap<K, V> class definition
+    //it's a HashMap<K, V> that can be used by many threads at the same time: the pairs are split in shards
+    //by the highest bits of their hash and every shard is a HashMap<K, V> protected by its own lock.
+    //the lookups of the same shard run in parallel under a shared lock, the modifications take the lock exclusively.
+    //the values are returned by copy because a reference could be invalidated by another thread
+    template<typename K, typename V = void, typename Hasher = Hash<typename PairTraits<K, V>::Key>, template<typename> class Table = ChainedTable> class ConcurrentHashMap final {
+        public:
+            using Key = typename HashMap<K, V, Hasher, Table>::Key;
+            using Value = typename HashMap<K, V, Hasher, Table>::Value;
+            using LookupKey = typename HashMap<K, V, Hasher, Table>::LookupKey;
+
+
+        private:
+            //every shard is aligned to a cache line so that the locks of different shards don't share it
+            struct alignas(64) Shard {
+                mutable std::shared_mutex mutex;
+                HashMap<K, V, Hasher, Table> map;
+            };
+
+
+            //maximum number of shards, the shard of a key is given by the 16 highest bits of its hash
+            static constexpr int maximumShards = 1 << 16;
+
+
+
+
+            std::unique_ptr<Shard[]> shards;
+            int shardNumber;
+            Hasher hasher;
+
+
+            Shard& findShard(std::uint64_t) const noexcept;
+
+
+        public:
+            template<typename... Args> bool tryEmplace(Key, Args&&...);
+            template<typename M> bool insertOrAssign(Key, M&&);
+            template<typename Function> bool compute(Key, Function&&);
+            template<typename Predicate> int eraseIf(Predicate&&);
+            bool remove(LookupKey);
+            bool exist(LookupKey) const;
+            std::optional<Value> get(LookupKey) const;
+            int getLength(void) const;
+            int getShardNumber(void) const noexcept;
+
+
+            ConcurrentHashMap(const ConcurrentHashMap<K, V, Hasher, Table>&) = delete;
+            ConcurrentHashMap<K, V, Hasher, Table>& operator=(const ConcurrentHashMap<K, V, Hasher, Table>&) = delete;
+
+            ConcurrentHashMap(int, const Hasher& = Hasher());
+            ConcurrentHashMap(void);
+    };
+
+
+
+
+
+
+    //CONCURRENTHASHMAP
+    //CONSTRUCTOR
+    //shardNumber is rounded up to a power of two
+    template<typename K, typename V, typename Hasher, template<typename> class Table> ConcurrentHashMap<K, V, Hasher, Table>::ConcurrentHashMap(int shardNumber, const Hasher& hasher): shardNumber(1), hasher(hasher) {
+        while(this->shardNumber < shardNumber && this->shardNumber < maximumShards) this->shardNumber <<= 1;
+
+        shards.reset(new Shard[this->shardNumber]);
+    }
+
+    //CONSTRUCTOR
+    template<typename K, typename V, typename Hasher, template<typename> class Table> ConcurrentHashMap<K, V, Hasher, Table>::ConcurrentHashMap(): ConcurrentHashMap(64) {}
+
+
+
+
+    //METHODS
+    //returns the shard of a hash value, the tables inside the shards use its lowest bits
+    template<typename K, typename V, typename Hasher, template<typename> class Table> typename ConcurrentHashMap<K, V, Hasher, Table>::Shard& ConcurrentHashMap<K, V, Hasher, Table>::findShard(std::uint64_t hashValue) const noexcept {
+        return shards[(hashValue >> 48) & (shardNumber - 1)];
+    }
+
+    //constructs a pair in place if the key doesn't exist, returns false if it already exists
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename... Args> bool ConcurrentHashMap<K, V, Hasher, Table>::tryEmplace(Key key, Args&&... args) {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        Shard& shard = findShard(hashValue);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map.rehashStep();
+
+        if(shard.map.probePair(hashValue, key)) return false;
+
+
+        shard.map.insertEntry(hashValue, std::move(key), std::in_place, std::forward<Args>(args)...);
+        return true;
+    }
+
+    //assigns the value to the key, adding the pair if it doesn't exist. it returns true if the pair has been added
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename M> bool ConcurrentHashMap<K, V, Hasher, Table>::insertOrAssign(Key key, M&& value) {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        Shard& shard = findShard(hashValue);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map.rehashStep();
+
+        if(Pair<K, V>* pair = shard.map.probePair(hashValue, key)) {
+            pair->getValue() = std::forward<M>(value);
+            return false;
+        }
+
+
+        shard.map.insertEntry(hashValue, std::move(key), std::in_place, std::forward<M>(value));
+        return true;
+    }
+
+    //updates the value of a key atomically: the function receives a std::optional<V>& that holds the current value,
+    //or nothing if the key doesn't exist, and the pair is added, assigned or removed following what it leaves in it.
+    //it returns true if the key exists after the call, if the function throws the map keeps the value it had
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename Function> bool ConcurrentHashMap<K, V, Hasher, Table>::compute(Key key, Function&& function) {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        Shard& shard = findShard(hashValue);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map.rehashStep();
+
+
+        Pair<K, V>* pair = shard.map.probePair(hashValue, key);
+        std::optional<Value> value;
+
+        if(pair) value = pair->getValue();
+
+        function(value);
+
+
+        if(value && pair) pair->getValue() = std::move(*value);
+        else if(value) shard.map.insertEntry(hashValue, std::move(key), std::in_place, std::move(*value));
+        else if(pair) shard.map.erasePair(hashValue, key);
+
+        return value.has_value();
+    }
+
+    //removes every pair for which the predicate, called with the key and the value, returns true.
+    //the shards are visited one at a time, so the pairs added meanwhile to the visited shards are kept
+    template<typename K, typename V, typename Hasher, template<typename> class Table> template<typename Predicate> int ConcurrentHashMap<K, V, Hasher, Table>::eraseIf(Predicate&& predicate) {
+        int removedNumber = 0;
+
+        for(int i = 0; i < shardNumber; i++) {
+            std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+            HashMap<K, V, Hasher, Table>& map = shards[i].map;
+
+
+            //the keys are collected first because removing a pair can compact the entries
+            std::vector<std::pair<std::uint64_t, Key>> removedKeys;
+
+            for(auto& entry : map.entries) {
+                if(entry && predicate(static_cast<const Key&>(entry->pair.getKey()), entry->pair.getValue())) removedKeys.emplace_back(entry->hashValue, entry->pair.getKey());
+            }
+
+            for(auto& removedKey : removedKeys) map.erasePair(removedKey.first, removedKey.second);
+
+            removedNumber += static_cast<int>(removedKeys.size());
+        }
+
+
+        return removedNumber;
+    }
+
+    //removes the pair with the specified key, returns false if it doesn't exist
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool ConcurrentHashMap<K, V, Hasher, Table>::remove(LookupKey key) {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        Shard& shard = findShard(hashValue);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map.rehashStep();
+
+        return shard.map.erasePair(hashValue, key);
+    }
+
+    //checks if a key exist in the map
+    template<typename K, typename V, typename Hasher, template<typename> class Table> bool ConcurrentHashMap<K, V, Hasher, Table>::exist(LookupKey key) const {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        const Shard& shard = findShard(hashValue);
+
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        return shard.map.findPair(hashValue, key) != nullptr;
+    }
+
+    //returns a copy of the value associated with the specified key, or nothing if it doesn't exist
+    template<typename K, typename V, typename Hasher, template<typename> class Table> std::optional<typename ConcurrentHashMap<K, V, Hasher, Table>::Value> ConcurrentHashMap<K, V, Hasher, Table>::get(LookupKey key) const {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher, Table>::calculateHashValue(hasher, key);
+        const Shard& shard = findShard(hashValue);
+
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        const Pair<K, V>* pair = shard.map.findPair(hashValue, key);
+
+        if(!pair) return std::nullopt;
+
+        return const_cast<Pair<K, V>*>(pair)->getValue();
+    }
+
+    //returns the number of pairs in the map, the shards are counted one at a time
+    template<typename K, typename V, typename Hasher, template<typename> class Table> int ConcurrentHashMap<K, V, Hasher, Table>::getLength() const {
+        int length = 0;
+
+        for(int i = 0; i < shardNumber; i++) {
+            std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+            length += shards[i].map.getLength();
+        }
+
+
+        return length;
+    }
+
+    //returns the number of shards
+    template<typename K, typename V, typename Hasher, template<typename> class Table> int ConcurrentHashMap<K, V, Hasher, Table>::getShardNumber() const noexcept {
+        return this->shardNumber;
+    }
+
+    #pragma endregion
+
+    #pragma region HASHMAPSNAPSHOT
+    //HashMapSnapshot<K, V> class definition
+    //read only view of a HashMap<K, V> saved by saveSnapshot(). the file is mapped in memory and the lookups read it
+    //in place, so opening a snapshot takes the same time whatever the number of pairs. the keys must be std::string
+    //or trivially copyable and the values trivially copyable. a mutable map is obtained by passing the snapshot to
+    //the constructor of HashMap<K, V>, which copies the pairs with their saved hash values.
+    //after the header the file contains the buckets (offsets in the slots array), the slots (hash value and index
+    //of the pairs, sorted by bucket), the keys and the values in insertion order. every section starts at a multiple
+    //of 64 bytes and the header keeps a checksum of itself and one of the rest of the file
+    template<typename K, typename V, typename Hasher> class HashMapSnapshot final {
+        public:
+            using Key = typename PairTraits<K, V>::Key;
+            using Value = typename PairTraits<K, V>::Value;
+            using LookupKey = std::conditional_t<std::is_same_v<Key, std::string>, std::string_view, const Key&>;
+
+
+        private:
+            struct Header {
+                char magic[8];
+                std::uint32_t version;
+                std::uint32_t byteOrder;
+                std::uint32_t keySize;
+                std::uint32_t valueSize;
+                std::uint64_t length;
+                std::uint64_t bucketNumber;
+                std::uint64_t bucketsOffset;
+                std::uint64_t slotsOffset;
+                std::uint64_t keysOffset;
+                std::uint64_t keyBytesOffset;
+                std::uint64_t valuesOffset;
+                std::uint64_t fileSize;
+                std::uint64_t checksum;
+                std::uint64_t headerChecksum;
+            };
+
+            struct Slot {
+                std::uint64_t hashValue;
+                std::uint64_t index;
+            };
+
+            struct alignas(64) Line {
+                unsigned char bytes[64];
+            };
+
+
+            static constexpr char fileMagic[8] = {'D', 'S', 'A', 'H', 'M', 'A', 'P', '\0'};
+            static constexpr std::uint32_t formatVersion = 1;
+            static constexpr std::uint32_t byteOrderMark = 0x01020304u;
+
+            //the checks are in a constant so that they fail only when a snapshot is used, not when the constructor
+            //of HashMap<K, V> that receives a snapshot is merely considered by the overload resolution
+            static constexpr bool checkTypes(void);
+
+
+
+
+            const unsigned char* data;
+            std::size_t size;
+            void* mapping;
+            std::vector<Line> buffer;
+            const Header* header;
+            Hasher hasher;
+
+
+            static std::size_t align(std::size_t) noexcept;
+            static std::uint64_t calculateChecksum(const void*, std::size_t) noexcept;
+            template<typename Map> static void save(const std::string&, const Map&);
+            static void writeFile(const std::string&, const void*, std::size_t);
+            void load(const std::string&);
+            void validate(void);
+            void release(void) noexcept;
+            const std::uint64_t* getBuckets(void) const noexcept;
+            const Slot* getSlots(void) const noexcept;
+            bool hasValidKey(std::uint64_t) const noexcept;
+            LookupKey readKey(std::uint64_t) const noexcept;
+            const Value& readValue(std::uint64_t) const noexcept;
+
+
+            //the map saves itself with save() and reads the pairs with their hash values when it's promoted
+            template<typename, typename, typename, template<typename> class> friend class HashMap;
+
+
+        public:
+            const Value* find(LookupKey) const;
+            bool exist(LookupKey) const;
+            const Value& operator[](LookupKey) const;
+            LookupKey getKey(int) const;
+            const Value& getValue(int) const;
+            int getLength(void) const noexcept;
+            bool verify(void) const noexcept;
+
+
+            HashMapSnapshot(const HashMapSnapshot<K, V, Hasher>&) = delete;
+            HashMapSnapshot<K, V, Hasher>& operator=(const HashMapSnapshot<K, V, Hasher>&) = delete;
+
+            explicit HashMapSnapshot(const std::string&, const Hasher& = Hasher());
+            HashMapSnapshot(HashMapSnapshot<K, V, Hasher>&&) noexcept;
+            ~HashMapSnapshot(void);
+    };
+
+
+
+
+
+
+    //HASHMAPSNAPSHOT
+    //CONSTRUCTOR
+    //maps the file at the specified path, the header is validated but the rest of the file is read only when it's used
+    template<typename K, typename V, typename Hasher> HashMapSnapshot<K, V, Hasher>::HashMapSnapshot(const std::string& path, const Hasher& hasher): data(nullptr), size(0), mapping(nullptr), header(nullptr), hasher(hasher) {
+        static_assert(checkTypes());
+
+        load(path);
+
+        try {
+            validate();
+        }
+        catch(...) {
+            release();
+            throw;
+        }
+    }
+
+    //MOVE CONSTRUCTOR
+    template<typename K, typename V, typename Hasher> HashMapSnapshot<K, V, Hasher>::HashMapSnapshot(HashMapSnapshot<K, V, Hasher>&& other) noexcept: data(other.data), size(other.size), mapping(other.mapping), buffer(std::move(other.buffer)), header(other.header), hasher(std::move(other.hasher)) {
+        other.data = nullptr;
+        other.size = 0;
+        other.mapping = nullptr;
+        other.header = nullptr;
+    }
+
+    //DESTRUCTOR
+    template<typename K, typename V, typename Hasher> HashMapSnapshot<K, V, Hasher>::~HashMapSnapshot() {
+        release();
+    }
+
+
+
+
+    //METHODS
+    //checks that the keys and the values can be copied to and from the file as bytes
+    template<typename K, typename V, typename Hasher> constexpr bool HashMapSnapshot<K, V, Hasher>::checkTypes() {
+        static_assert(std::is_same_v<Key, std::string> || std::is_trivially_copyable_v<Key>, "The keys of a HashMapSnapshot<K, V> must be std::string or trivially copyable!");
+        static_assert(std::is_trivially_copyable_v<Value>, "The values of a HashMapSnapshot<K, V> must be trivially copyable!");
+        static_assert(alignof(Key) <= 64 && alignof(Value) <= 64, "The keys and the values of a HashMapSnapshot<K, V> must be aligned to at most 64 bytes!");
+
+        return true;
+    }
+
+    //rounds a size up to a multiple of 64 bytes
+    template<typename K, typename V, typename Hasher> std::size_t HashMapSnapshot<K, V, Hasher>::align(std::size_t size) noexcept {
+        return (size + 63) & ~static_cast<std::size_t>(63);
+    }
+
+    //hashes a range of bytes of the file
+    template<typename K, typename V, typename Hasher> std::uint64_t HashMapSnapshot<K, V, Hasher>::calculateChecksum(const void* bytes, std::size_t length) noexcept {
+        return Hash<std::string>::hashBytes(bytes, length, formatVersion);
+    }
+
+    //writes the pairs of a map to a temporary file, which then replaces the one at the path.
+    //the old file is never truncated, so the snapshots that have it mapped stay valid
+    template<typename K, typename V, typename Hasher> template<typename Map> void HashMapSnapshot<K, V, Hasher>::save(const std::string& path, const Map& map) {
+        static_assert(checkTypes());
+
+        std::vector<const typename Map::Entry*> pairs;
+        std::uint64_t bucketNumber = 1;
+        std::size_t keyBytesSize = 0;
+        Header header{};
+
+        pairs.reserve(map.table.getLength());
+
+        for(const auto& entry : map.entries) {
+            if(!entry) continue;
+
+
+            pairs.push_back(&*entry);
+
+            if constexpr(std::is_same_v<Key, std::string>) keyBytesSize += entry->pair.getKey().size();
+        }
+
+        while(bucketNumber < pairs.size()) bucketNumber <<= 1;
+
+
+        std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+        header.version = formatVersion;
+        header.byteOrder = byteOrderMark;
+        header.keySize = std::is_same_v<Key, std::string> ? 0 : sizeof(Key);
+        header.valueSize = sizeof(Value);
+        header.length = pairs.size();
+        header.bucketNumber = bucketNumber;
+        header.bucketsOffset = align(sizeof(Header));
+        header.slotsOffset = align(header.bucketsOffset + (bucketNumber + 1) * sizeof(std::uint64_t));
+        header.keysOffset = align(header.slotsOffset + pairs.size() * sizeof(Slot));
+
+        if constexpr(std::is_same_v<Key, std::string>)
+            header.keyBytesOffset = align(header.keysOffset + (pairs.size() + 1) * sizeof(std::uint64_t));
+        else
+            header.keyBytesOffset = align(header.keysOffset + pairs.size() * sizeof(Key));
+
+        header.valuesOffset = align(header.keyBytesOffset + keyBytesSize);
+        header.fileSize = align(header.valuesOffset + pairs.size() * sizeof(Value));
+
+
+        std::vector<Line> file(header.fileSize / sizeof(Line));
+        unsigned char* bytes = file.data()->bytes;
+        std::uint64_t* buckets = reinterpret_cast<std::uint64_t*>(bytes + header.bucketsOffset);
+        Slot* slots = reinterpret_cast<Slot*>(bytes + header.slotsOffset);
+
+        //the slots are sorted by bucket with a counting sort, buckets[b] is the first slot of the bucket b
+        for(const auto* pair : pairs) buckets[(pair->hashValue & (bucketNumber - 1)) + 1]++;
+        for(std::uint64_t i = 0; i < bucketNumber; i++) buckets[i + 1] += buckets[i];
+
+        std::vector<std::uint64_t> positions(buckets, buckets + bucketNumber);
+
+        for(std::size_t i = 0; i < pairs.size(); i++) {
+            const std::uint64_t bucket = pairs[i]->hashValue & (bucketNumber - 1);
+
+            slots[positions[bucket]++] = Slot{pairs[i]->hashValue, i};
+        }
+
+
+        if constexpr(std::is_same_v<Key, std::string>) {
+            std::uint64_t* keyOffsets = reinterpret_cast<std::uint64_t*>(bytes + header.keysOffset);
+            std::uint64_t offset = 0;
+
+            for(std::size_t i = 0; i < pairs.size(); i++) {
+                const std::string& key = pairs[i]->pair.getKey();
+
+                std::memcpy(bytes + header.keyBytesOffset + offset, key.data(), key.size());
+                keyOffsets[i] = offset;
+                offset += key.size();
+            }
+
+            keyOffsets[pairs.size()] = offset;
+        }
+        else {
+            for(std::size_t i = 0; i < pairs.size(); i++) std::memcpy(bytes + header.keysOffset + i * sizeof(Key), &pairs[i]->pair.getKey(), sizeof(Key));
+        }
+
+        for(std::size_t i = 0; i < pairs.size(); i++) {
+            std::memcpy(bytes + header.valuesOffset + i * sizeof(Value), &const_cast<Pair<K, V>&>(pairs[i]->pair).getValue(), sizeof(Value));
+        }
+
+
+        header.checksum = calculateChecksum(bytes + header.bucketsOffset, header.fileSize - header.bucketsOffset);
+        header.headerChecksum = calculateChecksum(&header, offsetof(Header, headerChecksum));
+        std::memcpy(bytes, &header, sizeof(Header));
+
+
+        writeFile(path, bytes, header.fileSize);
+    }
+
+    //writes the bytes to a temporary file that is synced to the disk before it replaces the one at the path,
+    //then syncs the directory so that the rename survives a crash too. after a crash the path holds either
+    //the old snapshot or the whole new one, never a truncated file. without the POSIX calls the file is only flushed
+    template<typename K, typename V, typename Hasher> void HashMapSnapshot<K, V, Hasher>::writeFile(const std::string& path, const void* bytes, std::size_t size) {
+        const std::string temporaryPath = path + ".tmp";
+
+        #if defined(__unix__) || defined(__APPLE__)
+            const int descriptor = ::open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            if(descriptor < 0) throw std::runtime_error("Cannot write the snapshot of the HashMap<T>!");
+
+
+            const unsigned char* next = static_cast<const unsigned char*>(bytes);
+            std::size_t remaining = size;
+            bool written = true;
+
+            while(remaining > 0 && written) {
+                const ssize_t result = ::write(descriptor, next, remaining);
+
+                if(result > 0) {
+                    next += result;
+                    remaining -= static_cast<std::size_t>(result);
+                }
+                else if(result < 0 && errno == EINTR) {
+                    continue;
+                }
+                else {
+                    written = false;
+                }
+            }
+
+            written = written && ::fsync(descriptor) == 0;
+            written = (::close(descriptor) == 0) && written;
+
+            if(!written || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+                std::remove(temporaryPath.c_str());
+                throw std::runtime_error("Cannot write the snapshot of the HashMap<T>!");
+            }
+
+
+            const std::size_t separator = path.find_last_of('/');
+            const std::string directory = (separator == std::string::npos) ? "." : (separator == 0) ? "/" : path.substr(0, separator);
+            const int directoryDescriptor = ::open(directory.c_str(), O_RDONLY);
+
+            if(directoryDescriptor < 0) throw std::runtime_error("Cannot sync the directory of the snapshot of the HashMap<T>!");
+
+            const bool synced = ::fsync(directoryDescriptor) == 0;
+            ::close(directoryDescriptor);
+
+            if(!synced) throw std::runtime_error("Cannot sync the directory of the snapshot of the HashMap<T>!");
+        #else
+            std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+
+            stream.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+            stream.flush();
+            stream.close();
+
+            if(!stream) {
+                std::remove(temporaryPath.c_str());
+                throw std::runtime_error("Cannot write the snapshot of the HashMap<T>!");
+            }
+
+            //std::rename doesn't replace an existing file on every system: only then the old snapshot is removed first,
+            //so on those systems a crash between the two calls leaves no snapshot at the path
+            if(std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+                std::remove(path.c_str());
+
+                if(std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+                    std::remove(temporaryPath.c_str());
+                    throw std::runtime_error("Cannot write the snapshot of the HashMap<T>!");
+                }
+            }
+        #endif
+    }
+
+    //maps the file in memory, or reads it into an aligned buffer where mmap isn't available
+    template<typename K, typename V, typename Hasher> void HashMapSnapshot<K, V, Hasher>::load(const std::string& path) {
+        #if defined(__unix__) || defined(__APPLE__)
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+            struct stat status;
+
+            if(descriptor < 0) throw std::runtime_error("Cannot open the snapshot of the HashMap<T>!");
+
+            if(::fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(Header))) {
+                ::close(descriptor);
+                throw std::runtime_error("The file is not a snapshot of a HashMap<T>!");
+            }
+
+
+            void* address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+            ::close(descriptor);
+
+            if(address == MAP_FAILED) throw std::runtime_error("Cannot map the snapshot of the HashMap<T>!");
+
+
+            mapping = address;
+            data = static_cast<const unsigned char*>(address);
+            size = static_cast<std::size_t>(status.st_size);
+        #else
+            std::ifstream stream(path, std::ios::binary | std::ios::ate);
+
+            if(!stream) throw std::runtime_error("Cannot open the snapshot of the HashMap<T>!");
+
+
+            const std::streamoff fileSize = stream.tellg();
+
+            if(fileSize < static_cast<std::streamoff>(sizeof(Header))) throw std::runtime_error("The file is not a snapshot of a HashMap<T>!");
+
+
+            buffer.resize(align(static_cast<std::size_t>(fileSize)) / sizeof(Line));
+            stream.seekg(0);
+            stream.read(reinterpret_cast<char*>(buffer.data()), fileSize);
+
+            if(!stream) throw std::runtime_error("Cannot read the snapshot of the HashMap<T>!");
+
+
+            data = buffer.data()->bytes;
+            size = static_cast<std::size_t>(fileSize);
+        #endif
+
+        header = reinterpret_cast<const Header*>(data);
+    }
+
+    //checks the header and that the hasher gives the saved hash values. the sections are checked only by verify(),
+    //the lookups check the offsets they read so that a damaged file never makes them read outside of it
+    template<typename K, typename V, typename Hasher> void HashMapSnapshot<K, V, Hasher>::validate() {
+        if(std::memcmp(header->magic, fileMagic, sizeof(fileMagic)) != 0 || header->headerChecksum != calculateChecksum(header, offsetof(Header, headerChecksum)))
+            throw std::runtime_error("The file is not a snapshot of a HashMap<T>!");
+
+        if(header->version != formatVersion || header->byteOrder != byteOrderMark)
+            throw std::runtime_error("The snapshot of the HashMap<T> was saved in an unsupported format!");
+
+        if(header->keySize != (std::is_same_v<Key, std::string> ? 0 : sizeof(Key)) || header->valueSize != sizeof(Value))
+            throw std::runtime_error("The snapshot was saved by a HashMap<T> of different types!");
+
+
+        const std::uint64_t length = header->length;
+        const std::uint64_t bucketNumber = header->bucketNumber;
+        const std::uint64_t keysSize = std::is_same_v<Key, std::string> ? (length + 1) * sizeof(std::uint64_t) : length * sizeof(Key);
+
+        if(header->fileSize != size || length > 0x7FFFFFFFu || bucketNumber == 0 || (bucketNumber & (bucketNumber - 1)) != 0 || bucketNumber > size ||
+           header->bucketsOffset < sizeof(Header) || header->bucketsOffset % 64 != 0 || header->slotsOffset % 64 != 0 ||
+           header->keysOffset % 64 != 0 || header->keyBytesOffset % 64 != 0 || header->valuesOffset % 64 != 0 ||
+           header->bucketsOffset + (bucketNumber + 1) * sizeof(std::uint64_t) > header->slotsOffset ||
+           header->slotsOffset + length * sizeof(Slot) > header->keysOffset ||
+           header->keysOffset + keysSize > header->keyBytesOffset ||
+           header->keyBytesOffset > header->valuesOffset ||
+           header->valuesOffset + length * sizeof(Value) > size)
+            throw std::runtime_error("The snapshot of the HashMap<T> is damaged!");
+
+
+        if(length > 0) {
+            const Slot& slot = getSlots()[0];
+
+            if(slot.index >= length || HashMap<K, V, Hasher>::calculateHashValue(hasher, readKey(slot.index)) != slot.hashValue)
+                throw std::runtime_error("The snapshot was saved by a HashMap<T> with a different hasher!");
+        }
+    }
+
+    //unmaps the file
+    template<typename K, typename V, typename Hasher> void HashMapSnapshot<K, V, Hasher>::release() noexcept {
+        #if defined(__unix__) || defined(__APPLE__)
+            if(mapping) ::munmap(mapping, size);
+        #endif
+
+        mapping = nullptr;
+        data = nullptr;
+        header = nullptr;
+        size = 0;
+        buffer.clear();
+    }
+
+    //returns the offsets of the buckets in the slots array
+    template<typename K, typename V, typename Hasher> const std::uint64_t* HashMapSnapshot<K, V, Hasher>::getBuckets() const noexcept {
+        return reinterpret_cast<const std::uint64_t*>(data + header->bucketsOffset);
+    }
+
+    //returns the slots array
+    template<typename K, typename V, typename Hasher> const typename HashMapSnapshot<K, V, Hasher>::Slot* HashMapSnapshot<K, V, Hasher>::getSlots() const noexcept {
+        return reinterpret_cast<const Slot*>(data + header->slotsOffset);
+    }
+
+    //checks that the bytes of the key of the pair at an index are inside the section of the keys,
+    //keys of a fixed size are always valid
+    template<typename K, typename V, typename Hasher> bool HashMapSnapshot<K, V, Hasher>::hasValidKey(std::uint64_t index) const noexcept {
+        if constexpr(std::is_same_v<Key, std::string>) {
+            const std::uint64_t* keyOffsets = reinterpret_cast<const std::uint64_t*>(data + header->keysOffset);
+
+            return keyOffsets[index] <= keyOffsets[index + 1] && keyOffsets[index + 1] <= header->valuesOffset - header->keyBytesOffset;
+        }
+        else {
+            return true;
+        }
+    }
+
+    //returns the key of the pair at an index, a key whose offsets are damaged is returned empty
+    template<typename K, typename V, typename Hasher> typename HashMapSnapshot<K, V, Hasher>::LookupKey HashMapSnapshot<K, V, Hasher>::readKey(std::uint64_t index) const noexcept {
+        if constexpr(std::is_same_v<Key, std::string>) {
+            if(!hasValidKey(index)) return std::string_view();
+
+
+            const std::uint64_t* keyOffsets = reinterpret_cast<const std::uint64_t*>(data + header->keysOffset);
+            const std::uint64_t first = keyOffsets[index];
+
+            return std::string_view(reinterpret_cast<const char*>(data + header->keyBytesOffset + first), keyOffsets[index + 1] - first);
+        }
+        else {
+            return reinterpret_cast<const Key*>(data + header->keysOffset)[index];
+        }
+    }
+
+    //returns the value of the pair at an index
+    template<typename K, typename V, typename Hasher> const typename HashMapSnapshot<K, V, Hasher>::Value& HashMapSnapshot<K, V, Hasher>::readValue(std::uint64_t index) const noexcept {
+        return reinterpret_cast<const Value*>(data + header->valuesOffset)[index];
+    }
+
+    //returns the pointer to the value associated with the key, or nullptr if it doesn't exist.
+    //only the slots of the bucket of the key are read, their hash values are compared before the keys
+    template<typename K, typename V, typename Hasher> const typename HashMapSnapshot<K, V, Hasher>::Value* HashMapSnapshot<K, V, Hasher>::find(LookupKey key) const {
+        const std::uint64_t hashValue = HashMap<K, V, Hasher>::calculateHashValue(hasher, key);
+        const std::uint64_t bucket = hashValue & (header->bucketNumber - 1);
+        const std::uint64_t* buckets = getBuckets();
+        const Slot* slots = getSlots();
+        const std::uint64_t last = std::min(buckets[bucket + 1], header->length);
+
+
+        for(std::uint64_t i = buckets[bucket]; i < last; i++) {
+            if(slots[i].hashValue == hashValue && slots[i].index < header->length && readKey(slots[i].index) == key) return &readValue(slots[i].index);
+        }
+
+        return nullptr;
+    }
+
+    //checks if a key exist in the snapshot
+    template<typename K, typename V, typename Hasher> bool HashMapSnapshot<K, V, Hasher>::exist(LookupKey key) const {
+        return find(key) != nullptr;
+    }
+
+    //returns the reference to the value associated with the key
+    template<typename K, typename V, typename Hasher> const typename HashMapSnapshot<K, V, Hasher>::Value& HashMapSnapshot<K, V, Hasher>::operator[](LookupKey key) const {
+        const Value* value = find(key);
+
+        if(!value) throw std::runtime_error("The Pair<T> you're trying to access doesn't exist!");
+
+        return *value;
+    }
+
+    //returns the key of the pair at an index in insertion order
+    template<typename K, typename V, typename Hasher> typename HashMapSnapshot<K, V, Hasher>::LookupKey HashMapSnapshot<K, V, Hasher>::getKey(int index) const {
+        if(index < 0 || static_cast<std::uint64_t>(index) >= header->length) throw std::runtime_error("The index is out of the HashMapSnapshot<T>!");
+
+        return readKey(index);
+    }
+
+    //returns the value of the pair at an index in insertion order
+    template<typename K, typename V, typename Hasher> const typename HashMapSnapshot<K, V, Hasher>::Value& HashMapSnapshot<K, V, Hasher>::getValue(int index) const {
+        if(index < 0 || static_cast<std::uint64_t>(index) >= header->length) throw std::runtime_error("The index is out of the HashMapSnapshot<T>!");
+
+        return readValue(index);
+    }
+
+    //returns the number of pairs in the snapshot
+    template<typename K, typename V, typename Hasher> int HashMapSnapshot<K, V, Hasher>::getLength() const noexcept {
+        return static_cast<int>(header->length);
+    }
+
+    //checks the whole file against the checksum saved in the header, it reads every byte so it takes linear time
+    template<typename K, typename V, typename Hasher> bool HashMapSnapshot<K, V, Hasher>::verify() const noexcept {
+        return calculateChecksum(data + header->bucketsOffset, size - header->bucketsOffset) == header->checksum;
+    }
+
+    #pragma endregion
+
+    #pragma region FROZENHASHMAP
+    //FrozenHashMap<K, V> class definition
+    //immutable map built by HashMap<K, V>::freeze() for key sets that never change. the keys are placed with a minimal
+    //perfect hash in the style of CHD: every key falls in a bucket of about 4 keys and the displacement of the bucket
+    //moves its keys to slots that no other key uses, so n pairs fill exactly n slots and a lookup reads one
+    //displacement, one slot and compares one key. the values can still be modified
+    template<typename K, typename V, typename Hasher> class FrozenHashMap final {
+        public:
+            using Key = typename PairTraits<K, V>::Key;
+            using Value = typename PairTraits<K, V>::Value;
+            using LookupKey = std::conditional_t<std::is_same_v<Key, std::string>, std::string_view, const Key&>;
+
+
+        private:
+            struct Slot {
+                Pair<K, V> pair;
+                std::uint64_t hashValue;
+
+
+                Slot(const Pair<K, V>&, std::uint64_t);
+            };
+
+
+            //a displacement with the highest bit set is directly the slot of the only key of its bucket
+            static constexpr std::uint32_t directSlot = 0x80000000u;
+            //average number of keys in a bucket
+            static constexpr int bucketSize = 4;
+            //displacements tried for a bucket, and seeds tried for the whole map, before the construction gives up
+            static constexpr std::uint32_t maximumDisplacement = 1u << 20;
+            static constexpr int maximumAttempts = 32;
+
+
+
+
+            std::vector<Slot> slots;
+            std::vector<std::uint32_t> displacements;
+            std::size_t slotNumber;
+            std::uint64_t seed;
+            Hasher hasher;
+
+
+            std::size_t findBucket(std::uint64_t) const noexcept;
+            std::size_t findPosition(std::uint64_t, std::uint32_t) const noexcept;
+            const Slot* findSlot(LookupKey) const;
+            bool placeKeys(const std::vector<std::uint64_t>&, std::vector<std::uint32_t>&);
+
+
+        public:
+            Value* find(LookupKey);
+            bool exist(LookupKey) const;
+            Value& operator[](LookupKey);
+            int getLength(void) const noexcept;
+            template<typename Visitor> void forEach(Visitor&&);
+
+
+            template<template<typename> class Table> explicit FrozenHashMap(const HashMap<K, V, Hasher, Table>&);
+    };
+
+
+
+
+
+
+    //FROZENHASHMAP
+    //CONSTRUCTOR
+    //copies the pairs of the map and searches the displacements, a new seed is tried when a bucket can't be placed
+    template<typename K, typename V, typename Hasher> template<template<typename> class Table> FrozenHashMap<K, V, Hasher>::FrozenHashMap(const HashMap<K, V, Hasher, Table>& map): slotNumber(0), seed(0), hasher(map.hasher) {
+        std::vector<const Pair<K, V>*> pairs;
+        std::vector<std::uint64_t> hashValues;
+        std::vector<std::uint32_t> positions;
+
+        for(const auto& entry : map.entries) {
+            if(!entry) continue;
+
+
+            pairs.push_back(&entry->pair);
+            hashValues.push_back(entry->hashValue);
+        }
+
+        slotNumber = pairs.size();
+        displacements.assign(pairs.size() / bucketSize + 1, 0);
+
+
+        int attempt = 0;
+
+        while(!placeKeys(hashValues, positions)) {
+            if(++attempt == maximumAttempts) throw std::runtime_error("Cannot build the perfect hash of the HashMap<T>!");
+
+            seed = Hash<std::uint64_t>::mixInteger(seed + 0x9E3779B97F4A7C15ull);
+        }
+
+
+        std::vector<std::uint32_t> order(pairs.size());
+
+        for(std::size_t i = 0; i < pairs.size(); i++) order[positions[i]] = static_cast<std::uint32_t>(i);
+
+        slots.reserve(pairs.size());
+
+        for(std::uint32_t index : order) slots.emplace_back(*pairs[index], hashValues[index]);
+    }
+
+
+
+
+    //METHODS
+    //returns the bucket of a hash value
+    template<typename K, typename V, typename Hasher> std::size_t FrozenHashMap<K, V, Hasher>::findBucket(std::uint64_t hashValue) const noexcept {
+        return static_cast<std::size_t>(((Hash<std::uint64_t>::mixInteger(hashValue ^ seed) >> 32) * displacements.size()) >> 32);
+    }
+
+    //returns the slot of a hash value moved by the displacement of its bucket
+    template<typename K, typename V, typename Hasher> std::size_t FrozenHashMap<K, V, Hasher>::findPosition(std::uint64_t hashValue, std::uint32_t displacement) const noexcept {
+        const std::uint64_t mixedValue = Hash<std::uint64_t>::mixInteger(hashValue ^ ((displacement + 1ull) * 0x9E3779B97F4A7C15ull));
+
+        return static_cast<std::size_t>(((mixedValue >> 32) * slotNumber) >> 32);
+    }
+
+    //searches a displacement for every bucket, from the biggest to the smallest, and writes the slot of every key
+    //in positions. the buckets with a single key take the first free slot directly. returns false if a bucket
+    //can't be placed with the current seed
+    template<typename K, typename V, typename Hasher> bool FrozenHashMap<K, V, Hasher>::placeKeys(const std::vector<std::uint64_t>& hashValues, std::vector<std::uint32_t>& positions) {
+        const std::size_t length = hashValues.size();
+        const std::size_t bucketNumber = displacements.size();
+        std::vector<std::uint32_t> bucketStarts(bucketNumber + 1, 0);
+        std::vector<std::uint32_t> members(length);
+        std::vector<std::uint32_t> buckets(bucketNumber);
+        std::vector<bool> taken(length, false);
+        std::vector<std::size_t> candidates;
+
+        positions.assign(length, 0);
+
+
+        //the keys are grouped by bucket with a counting sort
+        for(std::size_t i = 0; i < length; i++) bucketStarts[findBucket(hashValues[i]) + 1]++;
+        for(std::size_t i = 0; i < bucketNumber; i++) bucketStarts[i + 1] += bucketStarts[i];
+
+        std::vector<std::uint32_t> next(bucketStarts.begin(), bucketStarts.end() - 1);
+
+        for(std::size_t i = 0; i < length; i++) members[next[findBucket(hashValues[i])]++] = static_cast<std::uint32_t>(i);
+
+        for(std::size_t i = 0; i < bucketNumber; i++) buckets[i] = static_cast<std::uint32_t>(i);
+
+        std::stable_sort(buckets.begin(), buckets.end(), [&bucketStarts](std::uint32_t a, std::uint32_t b) {
+            return bucketStarts[a + 1] - bucketStarts[a] > bucketStarts[b + 1] - bucketStarts[b];
+        });
+
+
+        std::size_t freeSlot = 0;
+
+        for(std::uint32_t bucket : buckets) {
+            const std::uint32_t first = bucketStarts[bucket];
+            const std::uint32_t last = bucketStarts[bucket + 1];
+
+            if(first == last) break;
+
+
+            if(last - first == 1) {
+                while(taken[freeSlot]) freeSlot++;
+
+                taken[freeSlot] = true;
+                positions[members[first]] = static_cast<std::uint32_t>(freeSlot);
+                displacements[bucket] = directSlot | static_cast<std::uint32_t>(freeSlot);
+                continue;
+            }
+
+
+            //two keys with the same hash value would collide with every displacement and every seed
+            for(std::uint32_t i = first; i < last; i++) {
+                for(std::uint32_t j = i + 1; j < last; j++) {
+                    if(hashValues[members[i]] == hashValues[members[j]]) throw std::runtime_error("The HashMap<T> has two keys with the same hash value and cannot be frozen!");
+                }
+            }
+
+
+            bool placed = false;
+
+            for(std::uint32_t displacement = 0; displacement < maximumDisplacement && !placed; displacement++) {
+                candidates.clear();
+                placed = true;
+
+                for(std::uint32_t i = first; i < last && placed; i++) {
+                    const std::size_t position = findPosition(hashValues[members[i]], displacement);
+
+                    placed = !taken[position] && std::find(candidates.begin(), candidates.end(), position) == candidates.end();
+                    candidates.push_back(position);
+                }
+
+                if(!placed) continue;
+
+
+                for(std::uint32_t i = first; i < last; i++) {
+                    taken[candidates[i - first]] = true;
+                    positions[members[i]] = static_cast<std::uint32_t>(candidates[i - first]);
+                }
+
+                displacements[bucket] = displacement;
+            }
+
+            if(!placed) return false;
+        }
+
+        return true;
+    }
+
+    //returns the only slot the key can be in, or nullptr if the key isn't there
+    template<typename K, typename V, typename Hasher> const typename FrozenHashMap<K, V, Hasher>::Slot* FrozenHashMap<K, V, Hasher>::findSlot(LookupKey key) const {
+        if(slots.empty()) return nullptr;
+
+
+        const std::uint64_t hashValue = HashMap<K, V, Hasher>::calculateHashValue(hasher, key);
+        const std::uint32_t displacement = displacements[findBucket(hashValue)];
+        const Slot& slot = slots[(displacement & directSlot) ? (displacement & ~directSlot) : findPosition(hashValue, displacement)];
+
+        return (slot.hashValue == hashValue && slot.pair.getKey() == key) ? &slot : nullptr;
+    }
+
+    //returns the pointer to the value associated with the key, or nullptr if it doesn't exist
+    template<typename K, typename V, typename Hasher> typename FrozenHashMap<K, V, Hasher>::Value* FrozenHashMap<K, V, Hasher>::find(LookupKey key) {
+        const Slot* slot = findSlot(key);
+
+        return slot ? &const_cast<Slot*>(slot)->pair.getValue() : nullptr;
+    }
+
+    //checks if a key exist in the map
+    template<typename K, typename V, typename Hasher> bool FrozenHashMap<K, V, Hasher>::exist(LookupKey key) const {
+        return findSlot(key) != nullptr;
+    }
+
+    //returns the reference to the value associated with the key
+    template<typename K, typename V, typename Hasher> typename FrozenHashMap<K, V, Hasher>::Value& FrozenHashMap<K, V, Hasher>::operator[](LookupKey key) {
+        Value* value = find(key);
+
+        if(!value) throw std::runtime_error("The Pair<T> you're trying to access doesn't exist!");
+
+        return *value;
+    }
+
+    //returns the number of pairs in the map
+    template<typename K, typename V, typename Hasher> int FrozenHashMap<K, V, Hasher>::getLength() const noexcept {
+        return static_cast<int>(slots.size());
+    }
+
+    //calls visitor(key, value) for every pair in the order of the slots
+    template<typename K, typename V, typename Hasher> template<typename Visitor> void FrozenHashMap<K, V, Hasher>::forEach(Visitor&& visitor) {
+        for(Slot& slot : slots) visitor(slot.pair.getKey(), slot.pair.getValue());
+    }
+
+
+
+
+    //SLOT
+    //CONSTRUCTOR
+    template<typename K, typename V, typename Hasher> FrozenHashMap<K, V, Hasher>::Slot::Slot(const Pair<K, V>& pair, std::uint64_t hashValue): pair(pair), hashValue(hashValue) {}
+
+    #pragma endregion
+
+
+    #pragma region RADIXTREE
+    //RadixTree<T> class definition
+    //ordered map from std::string keys to values, implemented as an adaptive radix tree. every node consumes one byte
+    //of the key and keeps in its prefix the bytes shared by all the keys below it, so a common prefix is stored once
+    //and a lookup costs O(key length) whatever the number of pairs. the nodes hold up to 4, 16, 48 or 256 children
+    //and are replaced by a bigger or a smaller kind as the children are added and removed.
+    //a key can be the prefix of another one, so every node can hold a value
+    template<typename T> class RadixTree final {
+        private:
+            enum class NodeType : std::uint8_t {node4, node16, node48, node256};
+
+            struct Node {
+                std::string prefix;
+                std::unique_ptr<T> value;
+                NodeType type;
+                std::uint16_t childNumber;
+            };
+
+            //the children of the small nodes are sorted by their byte
+            struct Node4 : Node {
+                unsigned char keys[4];
+                Node* children[4];
+            };
+
+            struct Node16 : Node {
+                unsigned char keys[16];
+                Node* children[16];
+            };
+
+            //index[byte] is the position of the child of that byte plus one, 0 if there isn't
+            struct Node48 : Node {
+                unsigned char index[256];
+                Node* children[48];
+            };
+
+            struct Node256 : Node {
+                Node* children[256];
+            };
+
+
+
+
+            Node* root;
+            int length;
+
+
+            static Node* createNode(NodeType);
+            static Node* createLeaf(std::string_view);
+            static void destroyNode(Node*) noexcept;
+            static void destroyTree(Node*) noexcept;
+            static Node* cloneTree(Node*);
+            static Node** findChild(Node*, unsigned char) noexcept;
+            static void addChild(Node*&, unsigned char, Node*);
+            static void removeChild(Node*&, unsigned char);
+            static void resizeNode(Node*&, NodeType);
+            static void compressNode(Node*&);
+            static std::size_t matchPrefix(const Node*, std::string_view, std::size_t) noexcept;
+            template<typename Visitor> static void forEachChild(Node*, Visitor&&);
+            template<typename Visitor> static int visit(Node*, std::string&, Visitor&);
+            Node* findNode(std::string_view) const noexcept;
+            std::unique_ptr<T>& insertKey(std::string_view);
+
+
+        public:
+            void add(const Pair<T>&);
+            void add(Pair<T>&&);
+            template<typename... Args> T& emplace(std::string_view, Args&&...);
+            void remove(std::string_view);
+            bool erase(std::string_view);
+            T& operator[](std::string_view);
+            T* find(std::string_view);
+            bool exist(std::string_view) const;
+            template<typename Visitor> int prefixScan(std::string_view, Visitor&&);
+            T* longestPrefixMatch(std::string_view, std::size_t* = nullptr);
+            template<typename Visitor> void forEach(Visitor&&);
+            std::vector<std::string> getKeys(void);
+            int getLength(void) const noexcept;
+            void clear(void) noexcept;
+            void swap(RadixTree<T>&) noexcept;
+            RadixTree<T>& operator=(const RadixTree<T>&);
+            RadixTree<T>& operator=(RadixTree<T>&&) noexcept;
+
+
+            RadixTree(void);
+            RadixTree(const RadixTree<T>&);
+            RadixTree(RadixTree<T>&&) noexcept;
+            ~RadixTree(void);
+    };
+
+
+
+
+
+
+    //RADIXTREE
+    //CONSTRUCTOR
+    template<typename T> RadixTree<T>::RadixTree(): root(nullptr), length(0) {}
+
+    //COPY CONSTRUCTOR
+    //copies the nodes keeping the same shape
+    template<typename T> RadixTree<T>::RadixTree(const RadixTree<T>& other): root(other.root ? cloneTree(other.root) : nullptr), length(other.length) {}
+
+    //MOVE CONSTRUCTOR
+    template<typename T> RadixTree<T>::RadixTree(RadixTree<T>&& other) noexcept: RadixTree() {
+        swap(other);
+    }
+
+    //DESTRUCTOR
+    template<typename T> RadixTree<T>::~RadixTree() {
+        clear();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename T> RadixTree<T>& RadixTree<T>::operator=(const RadixTree<T>& other) {
+        if(this != &other) {
+            RadixTree<T> copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T> RadixTree<T>& RadixTree<T>::operator=(RadixTree<T>&& other) noexcept {
+        if(this != &other) {
+            clear();
+            swap(other);
+        }
+
+        return *this;
+    }
+
+
+
+
+    //METHODS
+    //allocates an empty node of the specified kind, the arrays of the children are zeroed
+    template<typename T> typename RadixTree<T>::Node* RadixTree<T>::createNode(NodeType type) {
+        Node* node;
+
+        switch(type) {
+            case NodeType::node4: node = new Node4(); break;
+            case NodeType::node16: node = new Node16(); break;
+            case NodeType::node48: node = new Node48(); break;
+            default: node = new Node256(); break;
+        }
+
+        node->type = type;
+        node->childNumber = 0;
+
+        return node;
+    }
+
+    //allocates a Node4 without children and with the specified prefix
+    template<typename T> typename RadixTree<T>::Node* RadixTree<T>::createLeaf(std::string_view prefix) {
+        Node* node = createNode(NodeType::node4);
+
+        try {
+            node->prefix.assign(prefix);
+        }
+        catch(...) {
+            destroyNode(node);
+            throw;
+        }
+
+
+        return node;
+    }
+
+    //deletes a single node, its children are left alone
+    template<typename T> void RadixTree<T>::destroyNode(Node* node) noexcept {
+        switch(node->type) {
+            case NodeType::node4: delete static_cast<Node4*>(node); break;
+            case NodeType::node16: delete static_cast<Node16*>(node); break;
+            case NodeType::node48: delete static_cast<Node48*>(node); break;
+            default: delete static_cast<Node256*>(node); break;
+        }
+    }
+
+    //deletes a node and every node below it
+    template<typename T> void RadixTree<T>::destroyTree(Node* node) noexcept {
+        forEachChild(node, [](unsigned char, Node* child) {
+            destroyTree(child);
+        });
+
+        destroyNode(node);
+    }
+
+    //returns a copy of a node and of every node below it
+    template<typename T> typename RadixTree<T>::Node* RadixTree<T>::cloneTree(Node* node) {
+        Node* copy = createNode(node->type);
+
+        try {
+            copy->prefix = node->prefix;
+
+            if(node->value) copy->value = std::make_unique<T>(*node->value);
+
+            forEachChild(node, [&copy](unsigned char byte, Node* child) {
+                addChild(copy, byte, cloneTree(child));
+            });
+        }
+        catch(...) {
+            destroyTree(copy);
+            throw;
+        }
+
+
+        return copy;
+    }
+
+    //returns the address of the pointer to the child of a byte, or nullptr if there isn't.
+    //the 16 bytes of a Node16 are compared at once with SSE2 when available
+    template<typename T> typename RadixTree<T>::Node** RadixTree<T>::findChild(Node* node, unsigned char byte) noexcept {
+        switch(node->type) {
+            case NodeType::node4: {
+                Node4* small = static_cast<Node4*>(node);
+
+                for(int i = 0; i < small->childNumber; i++) {
+                    if(small->keys[i] == byte) return &small->children[i];
+                }
+
+                return nullptr;
+            }
+
+            case NodeType::node16: {
+                Node16* medium = static_cast<Node16*>(node);
+
+                #if defined(__SSE2__) || defined(_M_X64)
+                    const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(medium->keys));
+                    const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte))))) & ((1u << medium->childNumber) - 1);
+
+                    return mask ? &medium->children[lowestBit(mask)] : nullptr;
+                #else
+                    for(int i = 0; i < medium->childNumber; i++) {
+                        if(medium->keys[i] == byte) return &medium->children[i];
+                    }
+
+                    return nullptr;
+                #endif
+            }
+
+            case NodeType::node48: {
+                Node48* large = static_cast<Node48*>(node);
+
+                return large->index[byte] ? &large->children[large->index[byte] - 1] : nullptr;
+            }
+
+            default: {
+                Node256* full = static_cast<Node256*>(node);
+
+                return full->children[byte] ? &full->children[byte] : nullptr;
+            }
+        }
+    }
+
+    //adds the child of a byte that isn't already there, a full node is first replaced by a bigger one
+    template<typename T> void RadixTree<T>::addChild(Node*& node, unsigned char byte, Node* child) {
+        if(node->type == NodeType::node4 && node->childNumber == 4) resizeNode(node, NodeType::node16);
+        else if(node->type == NodeType::node16 && node->childNumber == 16) resizeNode(node, NodeType::node48);
+        else if(node->type == NodeType::node48 && node->childNumber == 48) resizeNode(node, NodeType::node256);
+
+
+        if(node->type == NodeType::node4 || node->type == NodeType::node16) {
+            unsigned char* keys = node->type == NodeType::node4 ? static_cast<Node4*>(node)->keys : static_cast<Node16*>(node)->keys;
+            Node** children = node->type == NodeType::node4 ? static_cast<Node4*>(node)->children : static_cast<Node16*>(node)->children;
+            int position = node->childNumber;
+
+            //the bigger children are shifted to keep the bytes sorted
+            while(position > 0 && keys[position - 1] > byte) {
+                keys[position] = keys[position - 1];
+                children[position] = children[position - 1];
+                position--;
+            }
+
+            keys[position] = byte;
+            children[position] = child;
+        }
+        else if(node->type == NodeType::node48) {
+            Node48* large = static_cast<Node48*>(node);
+            int position = 0;
+
+            while(large->children[position]) position++;
+
+            large->children[position] = child;
+            large->index[byte] = static_cast<unsigned char>(position + 1);
+        }
+        else {
+            static_cast<Node256*>(node)->children[byte] = child;
+        }
+
+        node->childNumber++;
+    }
+
+    //removes the child of a byte without deleting it, a node that becomes too empty is replaced by a smaller one
+    template<typename T> void RadixTree<T>::removeChild(Node*& node, unsigned char byte) {
+        if(node->type == NodeType::node4 || node->type == NodeType::node16) {
+            unsigned char* keys = node->type == NodeType::node4 ? static_cast<Node4*>(node)->keys : static_cast<Node16*>(node)->keys;
+            Node** children = node->type == NodeType::node4 ? static_cast<Node4*>(node)->children : static_cast<Node16*>(node)->children;
+            int position = 0;
+
+            while(keys[position] != byte) position++;
+
+            for(int i = position + 1; i < node->childNumber; i++) {
+                keys[i - 1] = keys[i];
+                children[i - 1] = children[i];
+            }
+        }
+        else if(node->type == NodeType::node48) {
+            Node48* large = static_cast<Node48*>(node);
+
+            large->children[large->index[byte] - 1] = nullptr;
+            large->index[byte] = 0;
+        }
+        else {
+            static_cast<Node256*>(node)->children[byte] = nullptr;
+        }
+
+        node->childNumber--;
+
+
+        //the smaller kind is chosen only when the node is well below its capacity, so that
+        //adding and removing a child at the boundary doesn't resize the node every time
+        if(node->type == NodeType::node256 && node->childNumber <= 36) resizeNode(node, NodeType::node48);
+        else if(node->type == NodeType::node48 && node->childNumber <= 12) resizeNode(node, NodeType::node16);
+        else if(node->type == NodeType::node16 && node->childNumber <= 3) resizeNode(node, NodeType::node4);
+    }
+
+    //replaces a node with one of another kind that takes its prefix, its value and its children
+    template<typename T> void RadixTree<T>::resizeNode(Node*& node, NodeType type) {
+        Node* resized = createNode(type);
+
+        resized->prefix = std::move(node->prefix);
+        resized->value = std::move(node->value);
+
+        forEachChild(node, [&resized](unsigned char byte, Node* child) {
+            addChild(resized, byte, child);
+        });
+
+        destroyNode(node);
+        node = resized;
+    }
+
+    //restores the path compression after a removal: a node without value is deleted if it has no children
+    //and merged with its child if it has only one
+    template<typename T> void RadixTree<T>::compressNode(Node*& node) {
+        if(node->value || node->childNumber > 1) return;
+
+
+        if(node->childNumber == 0) {
+            destroyNode(node);
+            node = nullptr;
+            return;
+        }
+
+
+        Node* child = nullptr;
+        unsigned char byte = 0;
+
+        forEachChild(node, [&child, &byte](unsigned char childByte, Node* only) {
+            child = only;
+            byte = childByte;
+        });
+
+        child->prefix.insert(0, 1, static_cast<char>(byte));
+        child->prefix.insert(0, node->prefix);
+
+        destroyNode(node);
+        node = child;
+    }
+
+    //returns the number of bytes of the prefix of a node equal to the key from depth
+    template<typename T> std::size_t RadixTree<T>::matchPrefix(const Node* node, std::string_view key, std::size_t depth) noexcept {
+        const std::size_t length = std::min(node->prefix.size(), key.size() - depth);
+        std::size_t common = 0;
+
+        while(common < length && node->prefix[common] == key[depth + common]) common++;
+
+        return common;
+    }
+
+    //calls visitor(byte, child) for every child of a node in the order of the bytes
+    template<typename T> template<typename Visitor> void RadixTree<T>::forEachChild(Node* node, Visitor&& visitor) {
+        switch(node->type) {
+            case NodeType::node4: {
+                Node4* small = static_cast<Node4*>(node);
+
+                for(int i = 0; i < small->childNumber; i++) visitor(small->keys[i], small->children[i]);
+                break;
+            }
+
+            case NodeType::node16: {
+                Node16* medium = static_cast<Node16*>(node);
+
+                for(int i = 0; i < medium->childNumber; i++) visitor(medium->keys[i], medium->children[i]);
+                break;
+            }
+
+            case NodeType::node48: {
+                Node48* large = static_cast<Node48*>(node);
+
+                for(int byte = 0; byte < 256; byte++) {
+                    if(large->index[byte]) visitor(static_cast<unsigned char>(byte), large->children[large->index[byte] - 1]);
+                }
+                break;
+            }
+
+            default: {
+                Node256* full = static_cast<Node256*>(node);
+
+                for(int byte = 0; byte < 256; byte++) {
+                    if(full->children[byte]) visitor(static_cast<unsigned char>(byte), full->children[byte]);
+                }
+                break;
+            }
+        }
+    }
+
+    //calls visitor(key, value) for the pairs below a node in the order of the keys, key holds the bytes
+    //of the path that leads to the node and is restored before returning. returns the number of pairs
+    template<typename T> template<typename Visitor> int RadixTree<T>::visit(Node* node, std::string& key, Visitor& visitor) {
+        const std::size_t pathLength = key.size();
+        int count = 0;
+
+        key += node->prefix;
+
+        if(node->value) {
+            visitor(static_cast<const std::string&>(key), *node->value);
+            count++;
+        }
+
+        forEachChild(node, [&key, &visitor, &count](unsigned char byte, Node* child) {
+            key.push_back(static_cast<char>(byte));
+            count += visit(child, key, visitor);
+            key.pop_back();
+        });
+
+
+        key.resize(pathLength);
+        return count;
+    }
+
+    //returns the node that holds the value of the key, or nullptr if the key doesn't exist
+    template<typename T> typename RadixTree<T>::Node* RadixTree<T>::findNode(std::string_view key) const noexcept {
+        Node* node = root;
+        std::size_t depth = 0;
+
+        while(node) {
+            if(key.size() - depth < node->prefix.size() || key.compare(depth, node->prefix.size(), node->prefix) != 0) return nullptr;
+
+            depth += node->prefix.size();
+
+            if(depth == key.size()) return node->value ? node : nullptr;
+
+
+            Node** child = findChild(node, static_cast<unsigned char>(key[depth]));
+
+            if(!child) return nullptr;
+
+            node = *child;
+            depth++;
+        }
+
+        return nullptr;
+    }
+
+    //returns the value slot of the node of the key, the node is created if it doesn't exist.
+    //a node whose prefix differs from the key is split at the first different byte.
+    //the new nodes are allocated before the tree is modified, so if an allocation throws the tree is left as it was
+    template<typename T> std::unique_ptr<T>& RadixTree<T>::insertKey(std::string_view key) {
+        Node** slot = &root;
+        std::size_t depth = 0;
+
+        while(true) {
+            Node* node = *slot;
+
+            if(!node) {
+                node = createLeaf(key.substr(depth));
+                *slot = node;
+
+                return node->value;
+            }
+
+
+            const std::size_t common = matchPrefix(node, key, depth);
+
+            //the split node and the key become the children of a new parent, or the key ends at the parent.
+            //adding two children to a new Node4 never resizes it, so nothing can throw once the nodes exist
+            if(common < node->prefix.size()) {
+                Node* parent = createLeaf(std::string_view(node->prefix).substr(0, common));
+                Node* leaf = nullptr;
+
+                if(depth + common < key.size()) {
+                    try {
+                        leaf = createLeaf(key.substr(depth + common + 1));
+                    }
+                    catch(...) {
+                        destroyNode(parent);
+                        throw;
+                    }
+                }
+
+
+                const unsigned char byte = static_cast<unsigned char>(node->prefix[common]);
+
+                node->prefix.erase(0, common + 1);
+                addChild(parent, byte, node);
+
+                if(leaf) addChild(parent, static_cast<unsigned char>(key[depth + common]), leaf);
+
+                *slot = parent;
+
+                return leaf ? leaf->value : parent->value;
+            }
+
+            depth += node->prefix.size();
+
+            if(depth == key.size()) return node->value;
+
+
+            Node** child = findChild(node, static_cast<unsigned char>(key[depth]));
+
+            if(!child) {
+                Node* leaf = createLeaf(key.substr(depth + 1));
+
+                try {
+                    addChild(*slot, static_cast<unsigned char>(key[depth]), leaf);
+                }
+                catch(...) {
+                    destroyNode(leaf);
+                    throw;
+                }
+
+
+                return leaf->value;
+            }
+
+            slot = child;
+            depth++;
+        }
+    }
+
+    //adds a copy of a Pair to the tree
+    template<typename T> void RadixTree<T>::add(const Pair<T>& pair) {
+        add(Pair<T>(pair));
+    }
+
+    //adds a Pair to the tree moving its value
+    template<typename T> void RadixTree<T>::add(Pair<T>&& pair) {
+        emplace(pair.getKey(), std::move(pair.getValue()));
+    }
+
+    //constructs the value associated with a key in place and returns its reference
+    template<typename T> template<typename... Args> T& RadixTree<T>::emplace(std::string_view key, Args&&... args) {
+        if(findNode(key)) throw std::runtime_error("A pair with the key \"" + std::string(key) + "\" already exist!");
+
+
+        //the value is constructed before any node is created and insertKey() changes nothing when it throws,
+        //so a throwing constructor or allocation leaves the tree as it was
+        std::unique_ptr<T> value = std::make_unique<T>(std::forward<Args>(args)...);
+        std::unique_ptr<T>& slot = insertKey(key);
+
+        slot = std::move(value);
+        length++;
+
+        return *slot;
+    }
+
+    //removes the pair with the specified key
+    template<typename T> void RadixTree<T>::remove(std::string_view key) {
+        if(!erase(key)) throw std::runtime_error("The Pair<T> you're trying to remove doesn't exist!");
+    }
+
+    //removes the pair with the specified key, returns false if it doesn't exist.
+    //the node of the key is deleted or merged with its only child, and so is its parent if it's left without value
+    template<typename T> bool RadixTree<T>::erase(std::string_view key) {
+        Node** slot = &root;
+        Node** parentSlot = nullptr;
+        unsigned char byte = 0;
+        std::size_t depth = 0;
+
+        while(true) {
+            Node* node = *slot;
+
+            if(!node || matchPrefix(node, key, depth) < node->prefix.size()) return false;
+
+            depth += node->prefix.size();
+
+            if(depth == key.size()) break;
+
+
+            Node** child = findChild(node, static_cast<unsigned char>(key[depth]));
+
+            if(!child) return false;
+
+            parentSlot = slot;
+            byte = static_cast<unsigned char>(key[depth]);
+            slot = child;
+            depth++;
+        }
+
+
+        Node* node = *slot;
+
+        if(!node->value) return false;
+
+
+        node->value.reset();
+        length--;
+
+        if(node->childNumber == 0 && parentSlot) {
+            destroyNode(node);
+            removeChild(*parentSlot, byte);
+            compressNode(*parentSlot);
+        }
+        else {
+            compressNode(*slot);
+        }
+
+        return true;
+    }
+
+    //returns the reference to the value associated with the key
+    template<typename T> T& RadixTree<T>::operator[](std::string_view key) {
+        Node* node = findNode(key);
+
+        if(!node) throw std::runtime_error("There is no value associated with the key \"" + std::string(key) + "\" in the RadixTree<T>!");
+
+        return *node->value;
+    }
+
+    //returns the pointer to the value associated with the key, or nullptr if it doesn't exist
+    template<typename T> T* RadixTree<T>::find(std::string_view key) {
+        Node* node = findNode(key);
+
+        return node ? node->value.get() : nullptr;
+    }
+
+    //checks if a key exist in the tree
+    template<typename T> bool RadixTree<T>::exist(std::string_view key) const {
+        return findNode(key) != nullptr;
+    }
+
+    //calls visitor(key, value) for every pair whose key starts with prefix, in the order of the keys, and returns
+    //their number. only the subtree of the prefix is visited. the key is a buffer reused by the next call
+    template<typename T> template<typename Visitor> int RadixTree<T>::prefixScan(std::string_view prefix, Visitor&& visitor) {
+        Node* node = root;
+        std::size_t depth = 0;
+
+        while(node) {
+            const std::size_t common = matchPrefix(node, prefix, depth);
+
+            if(depth + common == prefix.size()) {
+                std::string key(prefix.substr(0, depth));
+
+                return visit(node, key, visitor);
+            }
+
+            if(common < node->prefix.size()) return 0;
+
+
+            depth += node->prefix.size();
+
+            Node** child = findChild(node, static_cast<unsigned char>(prefix[depth]));
+
+            if(!child) return 0;
+
+            node = *child;
+            depth++;
+        }
+
+        return 0;
+    }
+
+    //returns the value of the longest key that is a prefix of the specified one, or nullptr if there isn't.
+    //if matchLength isn't nullptr it receives the length of that key
+    template<typename T> T* RadixTree<T>::longestPrefixMatch(std::string_view key, std::size_t* matchLength) {
+        Node* node = root;
+        T* match = nullptr;
+        std::size_t depth = 0;
+
+        while(node && matchPrefix(node, key, depth) == node->prefix.size()) {
+            depth += node->prefix.size();
+
+            if(node->value) {
+                match = node->value.get();
+
+                if(matchLength) *matchLength = depth;
+            }
+
+            if(depth == key.size()) break;
+
+
+            Node** child = findChild(node, static_cast<unsigned char>(key[depth]));
+
+            node = child ? *child : nullptr;
+            depth++;
+        }
+
+        return match;
+    }
+
+    //calls visitor(key, value) for every pair in the order of the keys
+    template<typename T> template<typename Visitor> void RadixTree<T>::forEach(Visitor&& visitor) {
+        prefixScan(std::string_view(), visitor);
+    }
+
+    //returns a vector of all the keys sorted
+    template<typename T> std::vector<std::string> RadixTree<T>::getKeys() {
+        std::vector<std::string> keys;
+
+        keys.reserve(length);
+
+        forEach([&keys](const std::string& key, T&) {
+            keys.push_back(key);
+        });
+
+        return keys;
+    }
+
+    //returns the number of pairs in the tree
+    template<typename T> int RadixTree<T>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //removes every pair
+    template<typename T> void RadixTree<T>::clear() noexcept {
+        if(root) destroyTree(root);
+
+        root = nullptr;
+        length = 0;
+    }
+
+    //exchanges the nodes of two trees in constant time
+    template<typename T> void RadixTree<T>::swap(RadixTree<T>& other) noexcept {
+        std::swap(root, other.root);
+        std::swap(length, other.length);
+    }
+
+    #pragma endregion
+
+
+    #pragma region STACK
+    //Stack<T> class definition
+    //the elements are stored in a contiguous buffer that doubles when it's full, so push, pop and top take constant
+    //(amortized) time. the first InlineCapacity elements live inside the object, so a stack that never grows
+    //beyond them doesn't allocate at all. by default they take about a cache line, and never less than one element
+    template<typename T, int InlineCapacity = ((64 / sizeof(T)) > 1) ? int(64 / sizeof(T)) : 1> class Stack final {
+        private:
+            struct alignas(T) Slot {
+                unsigned char storage[sizeof(T)];
+            };
+
+
+            static_assert(InlineCapacity > 0, "The inline capacity of a Stack<T> must be positive!");
+
+
+
+
+            Slot inlineSlots[InlineCapacity];
+            T* elements;
+            int length;
+            int capacity;
+
+
+            bool isInline(void) const noexcept;
+            void moveFrom(Stack<T, InlineCapacity>&) noexcept(std::is_nothrow_move_constructible_v<T>);
+            void releaseBuffer(void) noexcept;
+            template<typename... Args> T& growAndEmplace(Args&&...);
+
+
+        public:
+            void push(const T&);
+            void push(T&&);
+            template<typename... Args> T& emplace(Args&&...);
+            void pushBulk(const T*, int);
+            void pop(void);
+            int popBulk(T*, int);
+            T& top(void);
+            void reserve(int);
+            void clear(void) noexcept;
+            int getLength(void) const noexcept;
+            int getCapacity(void) const noexcept;
+            bool isEmpty(void) const noexcept;
+            std::string toString(void);
+            std::string toString(Modality::Direction);
+            Stack<T, InlineCapacity>& operator=(const Stack<T, InlineCapacity>&);
+            Stack<T, InlineCapacity>& operator=(Stack<T, InlineCapacity>&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+
+            Stack(void) noexcept;
+            Stack(const Stack<T, InlineCapacity>&);
+            Stack(Stack<T, InlineCapacity>&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+            ~Stack(void);
+    };
+
+
+
+
+
+
+
+
+    //STACK
+    //CONSTRUCTOR
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>::Stack() noexcept: elements(reinterpret_cast<T*>(inlineSlots)), length(0), capacity(InlineCapacity) {}
+
+    //COPY CONSTRUCTOR
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>::Stack(const Stack<T, InlineCapacity>& other): Stack() {
+        reserve(other.length);
+
+        for(int i = 0; i < other.length; i++) push(other.elements[i]);
+    }
+
+    //MOVE CONSTRUCTOR
+    //a buffer on the heap is taken as it is, the inline elements are moved one by one
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>::Stack(Stack<T, InlineCapacity>&& other) noexcept(std::is_nothrow_move_constructible_v<T>): Stack() {
+        moveFrom(other);
+    }
+
+    //DESTRUCTOR
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>::~Stack() {
+        clear();
+        releaseBuffer();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>& Stack<T, InlineCapacity>::operator=(const Stack<T, InlineCapacity>& other) {
+        if(this != &other) {
+            Stack<T, InlineCapacity> copy(other);
+
+            clear();
+            releaseBuffer();
+            moveFrom(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T, int InlineCapacity> Stack<T, InlineCapacity>& Stack<T, InlineCapacity>::operator=(Stack<T, InlineCapacity>&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if(this != &other) {
+            clear();
+            releaseBuffer();
+            moveFrom(other);
+        }
+
+        return *this;
+    }
+
+
+
+
+    //METHODS
+    //returns if the elements are stored inside the object
+    template<typename T, int InlineCapacity> bool Stack<T, InlineCapacity>::isInline() const noexcept {
+        return elements == reinterpret_cast<const T*>(inlineSlots);
+    }
+
+    //takes the elements of another stack, which must be empty with its inline buffer, and leaves it empty
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::moveFrom(Stack<T, InlineCapacity>& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if(other.isInline()) {
+            for(; length < other.length; length++) new(&elements[length]) T(std::move(other.elements[length]));
+
+            other.clear();
+        }
+        else {
+            elements = other.elements;
+            length = other.length;
+            capacity = other.capacity;
+
+            other.elements = reinterpret_cast<T*>(other.inlineSlots);
+            other.length = 0;
+            other.capacity = InlineCapacity;
+        }
+    }
+
+    //frees the buffer on the heap, if any, and goes back to the inline one. the stack must be empty
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::releaseBuffer() noexcept {
+        if(!isInline()) std::allocator<T>().deallocate(elements, capacity);
+
+        elements = reinterpret_cast<T*>(inlineSlots);
+        capacity = InlineCapacity;
+    }
+
+    //constructs an element in a buffer of double capacity and then moves the others into it. the new element is
+    //constructed first because the arguments may refer to an element of the old buffer
+    template<typename T, int InlineCapacity> template<typename... Args> T& Stack<T, InlineCapacity>::growAndEmplace(Args&&... args) {
+        const int newCapacity = capacity * 2;
+        T* buffer = std::allocator<T>().allocate(newCapacity);
+        int moved = 0;
+
+        try {
+            new(&buffer[length]) T(std::forward<Args>(args)...);
+
+            try {
+                for(; moved < length; moved++) new(&buffer[moved]) T(std::move_if_noexcept(elements[moved]));
+            }
+            catch(...) {
+                for(int i = 0; i < moved; i++) buffer[i].~T();
+
+                buffer[length].~T();
+                throw;
+            }
+        }
+        catch(...) {
+            std::allocator<T>().deallocate(buffer, newCapacity);
+            throw;
+        }
+
+
+        const int oldLength = length;
+
+        clear();
+        releaseBuffer();
+
+        elements = buffer;
+        length = oldLength + 1;
+        capacity = newCapacity;
+
+        return elements[length - 1];
+    }
+
+    //add an element on top of the stack
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::push(const T& value) {
+        emplace(value);
+    }
+
+    //moves an element on top of the stack
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    //constructs an element in place on top of the stack and returns its reference
+    template<typename T, int InlineCapacity> template<typename... Args> T& Stack<T, InlineCapacity>::emplace(Args&&... args) {
+        if(length == capacity) return growAndEmplace(std::forward<Args>(args)...);
+
+
+        new(&elements[length]) T(std::forward<Args>(args)...);
+
+        return elements[length++];
+    }
+
+    //pushes count values in their order, so the last one ends on top. the buffer grows at most once and
+    //trivially copyable values are copied as a single block. values inside the stack are copied out before
+    //the buffer grows, and if a copy throws the stack is left as it was
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::pushBulk(const T* values, int count) {
+        if(count <= 0) return;
+
+        if(count > capacity - length) {
+            const bool inside = !std::less<const T*>()(values, elements) && std::less<const T*>()(values, elements + capacity);
+
+            if(inside) {
+                const std::vector<T> copy(values, values + count);
+
+                pushBulk(copy.data(), count);
+                return;
+            }
+
+            reserve(std::max(length + count, capacity * 2));
+        }
+
+
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(elements + length), values, count * sizeof(T));
+            length += count;
+        }
+        else {
+            int added = 0;
+
+            try {
+                for(; added < count; added++) new(&elements[length + added]) T(values[added]);
+            }
+            catch(...) {
+                while(added > 0) elements[length + --added].~T();
+
+                throw;
+            }
+
+            length += count;
+        }
+    }
+
+    //pops the top element of the stack
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::pop() {
+        if(length == 0) return;
+
+        elements[--length].~T();
+    }
+
+    //pops up to max elements and moves them into values in the order they were pushed, so the old top is the last
+    //one and pushBulk(values, count) restores the stack. returns the number of elements popped.
+    //the elements are move assigned, so values must hold at least max constructed elements. they're popped from the
+    //top one at a time, so if an assignment throws the stack keeps the elements not moved yet, all intact
+    template<typename T, int InlineCapacity> int Stack<T, InlineCapacity>::popBulk(T* values, int max) {
+        const int count = std::min(std::max(max, 0), length);
+        const int start = length - count;
+
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(values), elements + start, count * sizeof(T));
+            length = start;
+        }
+        else {
+            while(length > start) {
+                values[length - 1 - start] = std::move(elements[length - 1]);
+                elements[--length].~T();
+            }
+        }
+
+        return count;
+    }
+
+    //retuns the reference to the top element of the stack
+    template<typename T, int InlineCapacity> T& Stack<T, InlineCapacity>::top() {
+        if(length == 0) throw std::runtime_error("The Stack<T> is empty!");
+
+        return elements[length - 1];
+    }
+
+    //makes room for the specified number of elements without moving them again
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::reserve(int elementNumber) {
+        if(elementNumber <= capacity) return;
+
+
+        T* buffer = std::allocator<T>().allocate(elementNumber);
+        int moved = 0;
+
+        try {
+            for(; moved < length; moved++) new(&buffer[moved]) T(std::move_if_noexcept(elements[moved]));
+        }
+        catch(...) {
+            for(int i = 0; i < moved; i++) buffer[i].~T();
+
+            std::allocator<T>().deallocate(buffer, elementNumber);
+            throw;
+        }
+
+
+        const int oldLength = length;
+
+        clear();
+        releaseBuffer();
+
+        elements = buffer;
+        length = oldLength;
+        capacity = elementNumber;
+    }
+
+    //destroys every element, the buffer is kept
+    template<typename T, int InlineCapacity> void Stack<T, InlineCapacity>::clear() noexcept {
+        while(length > 0) elements[--length].~T();
+    }
+
+    //retuns the number of elements in the stack
+    template<typename T, int InlineCapacity> int Stack<T, InlineCapacity>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //returns the number of elements the stack can hold before it grows
+    template<typename T, int InlineCapacity> int Stack<T, InlineCapacity>::getCapacity() const noexcept {
+        return this->capacity;
+    }
+
+    //returns if the stack is empty or not
+    template<typename T, int InlineCapacity> bool Stack<T, InlineCapacity>::isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    //returns a string representing the stack from top to bottom
+    template<typename T, int InlineCapacity> std::string Stack<T, InlineCapacity>::toString() {
+        std::string stack = "________\n";
+
+        try {
+            for(int i = length - 1; i >= 0; i--) 
+                stack += std::to_string(elements[i]) + "\n";
+        }
+        catch(...) {
+            std::cerr<< "The value you're trying to represent can't be converted into a string!";
+        }
+        
+    
+        
+        return stack;
+    }
+
+    //returns a string representing the stack in a specified direction
+    template<typename T, int InlineCapacity> std::string Stack<T, InlineCapacity>::toString(Modality::Direction direction) {
+        try {
+            if(direction == Modality::Direction::topToBottom) {
+                return this->toString();
+            }
+            else {
+                std::string stack = "________\n";
+
+
+                for(int i = 0; i < length; i++) 
+                    stack += std::to_string(elements[i]) + "\n";
+
+
+                return stack;
+            }
+        }
+        catch(...) {
+            std::cerr<< "The value you're trying to represent can't be converted into a string!";
+            return "";
+        }
+    }
+
+
+
+
+    #pragma endregion
+
+    #pragma region CONCURRENTSTACK
+    //ConcurrentStack<T> class definition
+    //lock-free stack shared by many threads, built as a Treiber stack: the head is replaced with a compare and swap.
+    //a popped node is freed only when no thread has it in its hazard pointer, so a thread never reads a freed node
+    //and a node can't come back at the same address while a thread still compares it (the ABA problem).
+    //the hazard records are kept in a list that only grows, a thread that finds every record busy adds a new one,
+    //so no thread ever waits for another whatever the number of threads.
+    //when the head is contended, a push and a pop can meet in the elimination array and exchange the node
+    //without touching the head. the values are returned by copy because another thread may be reading them
+    template<typename T> class ConcurrentStack final {
+        private:
+            struct Node {
+                T value;
+                Node* next;
+
+
+                template<typename... Args> explicit Node(std::in_place_t, Args&&...);
+            };
+
+            //a thread owns a record for the duration of an operation: the hazard pointer protects the node it's
+            //reading and the retired nodes are the ones it popped and that may still be read by other threads.
+            //next never changes once the record is in the list
+            struct alignas(64) HazardRecord {
+                std::atomic<bool> active;
+                std::atomic<Node*> hazard;
+                std::vector<Node*> retired;
+                HazardRecord* next;
+            };
+
+            struct alignas(64) EliminationSlot {
+                std::atomic<Node*> node;
+            };
+
+
+            //a record frees its retired nodes when they're more than twice the records, and at least this many
+            static constexpr std::size_t minimumRetired = 64;
+            static constexpr int eliminationWidth = 8;
+            static constexpr int eliminationSpins = 128;
+
+
+
+
+            alignas(64) std::atomic<Node*> head;
+            alignas(64) mutable std::atomic<HazardRecord*> hazardRecords;
+            mutable std::atomic<std::size_t> recordNumber;
+            EliminationSlot eliminationSlots[eliminationWidth];
+
+
+            static std::uint32_t nextRandom(void) noexcept;
+            HazardRecord& acquireRecord(void) const;
+            static void releaseRecord(HazardRecord&) noexcept;
+            Node* protectHead(HazardRecord&) const noexcept;
+            void retire(HazardRecord&, Node*);
+            void reclaim(HazardRecord&);
+            void pushNode(Node*) noexcept;
+            bool eliminatePush(Node*) noexcept;
+            Node* eliminatePop(void) noexcept;
+
+
+        public:
+            void push(const T&);
+            void push(T&&);
+            template<typename... Args> void emplace(Args&&...);
+            std::optional<T> pop(void);
+            std::optional<T> top(void) const;
+            bool isEmpty(void) const noexcept;
+
+
+            ConcurrentStack(const ConcurrentStack<T>&) = delete;
+            ConcurrentStack<T>& operator=(const ConcurrentStack<T>&) = delete;
+
+            ConcurrentStack(void);
+            ~ConcurrentStack(void);
+    };
+
+
+
+
+
+
+    //CONCURRENTSTACK
+    //CONSTRUCTOR
+    template<typename T> ConcurrentStack<T>::ConcurrentStack(): head(nullptr), hazardRecords(nullptr), recordNumber(0) {
+        for(EliminationSlot& slot : eliminationSlots) slot.node.store(nullptr, std::memory_order_relaxed);
+    }
+
+    //DESTRUCTOR
+    //no other thread can use the stack anymore, so every node is freed
+    template<typename T> ConcurrentStack<T>::~ConcurrentStack() {
+        Node* node = head.load(std::memory_order_acquire);
+
+        while(node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+
+        HazardRecord* record = hazardRecords.load(std::memory_order_acquire);
+
+        while(record) {
+            HazardRecord* next = record->next;
+
+            for(Node* retired : record->retired) delete retired;
+
+            delete record;
+            record = next;
+        }
+
+        for(EliminationSlot& slot : eliminationSlots) delete slot.node.load(std::memory_order_acquire);
+    }
+
+
+
+
+    //METHODS
+    //returns a pseudo random number of the calling thread, used to spread the threads over the elimination array.
+    //the state is shared by every ConcurrentStack<T> of the same T, which only means that they share the sequence
+    template<typename T> std::uint32_t ConcurrentStack<T>::nextRandom() noexcept {
+        thread_local std::uint32_t state = static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        return state;
+    }
+
+    //takes a free hazard record of the list, or adds a new one to its front when they're all busy.
+    //the list has at most as many records as the threads that used the stack at the same time
+    template<typename T> typename ConcurrentStack<T>::HazardRecord& ConcurrentStack<T>::acquireRecord() const {
+        for(HazardRecord* record = hazardRecords.load(std::memory_order_acquire); record; record = record->next) {
+            if(!record->active.load(std::memory_order_relaxed) && !record->active.exchange(true, std::memory_order_acquire)) return *record;
+        }
+
+
+        HazardRecord* record = new HazardRecord();
+
+        record->active.store(true, std::memory_order_relaxed);
+        record->hazard.store(nullptr, std::memory_order_relaxed);
+        record->next = hazardRecords.load(std::memory_order_relaxed);
+
+        while(!hazardRecords.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed));
+
+        recordNumber.fetch_add(1, std::memory_order_relaxed);
+        return *record;
+    }
+
+    //gives back a hazard record, its retired nodes stay there for the next owner
+    template<typename T> void ConcurrentStack<T>::releaseRecord(HazardRecord& record) noexcept {
+        record.hazard.store(nullptr, std::memory_order_release);
+        record.active.store(false, std::memory_order_release);
+    }
+
+    //stores the head in the hazard pointer and returns it once it's sure it was still the head after being
+    //protected, since a node removed later can't be freed. returns nullptr if the stack is empty
+    template<typename T> typename ConcurrentStack<T>::Node* ConcurrentStack<T>::protectHead(HazardRecord& record) const noexcept {
+        Node* node = head.load(std::memory_order_acquire);
+
+        while(node) {
+            record.hazard.store(node, std::memory_order_seq_cst);
+
+            Node* current = head.load(std::memory_order_seq_cst);
+
+            if(current == node) return node;
+
+            node = current;
+        }
+
+        return nullptr;
+    }
 
+    //keeps a popped node until no hazard pointer refers to it
+    template<typename T> void ConcurrentStack<T>::retire(HazardRecord& record, Node* node) {
+        record.retired.push_back(node);
 
-                    Bucket(void);
-            };
+        if(record.retired.size() >= std::max(minimumRetired, 2 * recordNumber.load(std::memory_order_relaxed))) reclaim(record);
+    }
+
+    //frees the retired nodes of a record that aren't in any hazard pointer
+    template<typename T> void ConcurrentStack<T>::reclaim(HazardRecord& record) {
+        std::vector<Node*> hazards;
+
+        hazards.reserve(recordNumber.load(std::memory_order_relaxed));
+
+        for(HazardRecord* other = hazardRecords.load(std::memory_order_acquire); other; other = other->next) {
+            Node* hazard = other->hazard.load(std::memory_order_seq_cst);
+
+            if(hazard) hazards.push_back(hazard);
+        }
+
+        std::sort(hazards.begin(), hazards.end());
+
+
+        std::size_t kept = 0;
+
+        for(Node* node : record.retired) {
+            if(std::binary_search(hazards.begin(), hazards.end(), node)) record.retired[kept++] = node;
+            else delete node;
+        }
+
+        record.retired.resize(kept);
+    }
+
+    //links a node on top of the stack, trying the elimination array whenever the head is contended
+    template<typename T> void ConcurrentStack<T>::pushNode(Node* node) noexcept {
+        Node* expected = head.load(std::memory_order_relaxed);
+
+        while(true) {
+            node->next = expected;
+
+            if(head.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) return;
+
+            if(eliminatePush(node)) return;
+
+            expected = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    //offers a node in a random slot of the elimination array for a while, returns true if a pop took it
+    template<typename T> bool ConcurrentStack<T>::eliminatePush(Node* node) noexcept {
+        EliminationSlot& slot = eliminationSlots[nextRandom() % eliminationWidth];
+        Node* expected = nullptr;
+
+        if(!slot.node.compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed)) return false;
+
+
+        for(int i = 0; i < eliminationSpins; i++) {
+            if(slot.node.load(std::memory_order_acquire) != node) return true;
+
+            #if defined(__SSE2__) || defined(_M_X64)
+                _mm_pause();
+            #endif
+        }
+
+        //if the node can't be taken back a pop has taken it in the meantime
+        expected = node;
+        return !slot.node.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+
+    //takes the node offered in a random slot of the elimination array, if any. the node never was in the stack,
+    //so no other thread can read it
+    template<typename T> typename ConcurrentStack<T>::Node* ConcurrentStack<T>::eliminatePop() noexcept {
+        EliminationSlot& slot = eliminationSlots[nextRandom() % eliminationWidth];
+        Node* node = slot.node.load(std::memory_order_acquire);
+
+        if(node && slot.node.compare_exchange_strong(node, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed)) return node;
+
+        return nullptr;
+    }
+
+    //add an element on top of the stack
+    template<typename T> void ConcurrentStack<T>::push(const T& value) {
+        pushNode(new Node(std::in_place, value));
+    }
+
+    //moves an element on top of the stack
+    template<typename T> void ConcurrentStack<T>::push(T&& value) {
+        pushNode(new Node(std::in_place, std::move(value)));
+    }
+
+    //constructs an element in place on top of the stack
+    template<typename T> template<typename... Args> void ConcurrentStack<T>::emplace(Args&&... args) {
+        pushNode(new Node(std::in_place, std::forward<Args>(args)...));
+    }
+
+    //removes the top element and returns a copy of it, or nothing if the stack is empty. if the copy throws the
+    //element stays in the stack
+    template<typename T> std::optional<T> ConcurrentStack<T>::pop() {
+        HazardRecord& record = acquireRecord();
+
+        while(true) {
+            Node* node = protectHead(record);
+
+            if(!node) {
+                releaseRecord(record);
+                return std::nullopt;
+            }
+
+
+            //the value is copied before the node is unlinked: an unlinked node must never be linked again, since a
+            //thread that read its old next could still succeed in a compare and swap on it
+            std::optional<T> value;
+
+            try {
+                value.emplace(node->value);
+            }
+            catch(...) {
+                releaseRecord(record);
+                throw;
+            }
+
+
+            Node* expected = node;
+
+            if(head.compare_exchange_strong(expected, node->next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                record.hazard.store(nullptr, std::memory_order_release);
+
+                try {
+                    retire(record, node);
+                }
+                catch(...) {
+                    releaseRecord(record);
+                    throw;
+                }
+
+                releaseRecord(record);
+
+                return value;
+            }
+
+
+            Node* exchanged = eliminatePop();
+
+            if(exchanged) {
+                releaseRecord(record);
+
+                std::optional<T> value;
 
+                try {
+                    value.emplace(std::move(exchanged->value));
+                }
+                catch(...) {
+                    pushNode(exchanged);
+                    throw;
+                }
+
+                delete exchanged;
+                return value;
+            }
+        }
+    }
+
+    //returns a copy of the top element, or nothing if the stack is empty
+    template<typename T> std::optional<T> ConcurrentStack<T>::top() const {
+        HazardRecord& record = acquireRecord();
+        Node* node = protectHead(record);
+        std::optional<T> value;
+
+        try {
+            if(node) value.emplace(node->value);
+        }
+        catch(...) {
+            releaseRecord(record);
+            throw;
+        }
+
+        releaseRecord(record);
+        return value;
+    }
+
+    //returns if the stack is empty or not, the answer may be changed at once by another thread
+    template<typename T> bool ConcurrentStack<T>::isEmpty() const noexcept {
+        return head.load(std::memory_order_acquire) == nullptr;
+    }
 
 
 
 
+    //NODE
+    //CONSTRUCTOR
+    template<typename T> template<typename... Args> ConcurrentStack<T>::Node::Node(std::in_place_t, Args&&... args): value(std::forward<Args>(args)...), next(nullptr) {}
+
+    #pragma endregion
+
+
+    #pragma region QUEUE
+
+    //Queue<T> class definition
+    //the elements are stored in a circular buffer whose capacity is a power of two, so an index wraps around with
+    //a mask. enqueue, dequeue and head take constant (amortized) time and the buffer doubles when it's full
+    template<typename T> class Queue final {
+        private:
+            static constexpr int minimumCapacity = 16;
+
 
-            std::vector<Bucket> hashTable;
-            List<std::string> hashMapKeys;
-            const int maxElementNumber;
 
 
-            int calculateHashValue(const std::string&);
+            T* elements;
+            int capacity;
+            int first;
+            int length;
+
+
+            T& getElement(int) const noexcept;
+            void moveFrom(Queue<T>&) noexcept;
+            void releaseBuffer(void) noexcept;
+            template<typename... Args> T& growAndEmplace(Args&&...);
 
         
         public:
-            void add(Pair<T>);
-            void remove(std::string);
-            T& operator[](std::string);
-            bool exist(std::string);
+            void enqueue(const T&);
+            void enqueue(T&&);
+            template<typename... Args> T& emplace(Args&&...);
+            void enqueueBulk(const T*, int);
+            void dequeue(void);
+            int dequeueBulk(T*, int);
+            T& head(void);
+            void reserve(int);
+            void clear(void) noexcept;
+            int getLength(void) const noexcept;
+            int getCapacity(void) const noexcept;
+            bool isEmpty(void) const noexcept;
             std::string toString(void);
-            std::string toString(Modality::Association);
-            std::vector<std::string> getKeys(void);
-            std::vector<Pair<T>*> getPairs(void);
-
+            std::string toString(Modality::Verse);
+            Queue<T>& operator=(const Queue<T>&);
+            Queue<T>& operator=(Queue<T>&&) noexcept;
 
 
-            HashMap(int);
-            HashMap(void);
+            Queue(void) noexcept;
+            Queue(const Queue<T>&);
+            Queue(Queue<T>&&) noexcept;
+            ~Queue(void);
     };
 
 
@@ -445,459 +6085,735 @@ namespace DSA {
 
 
 
-    //HASHMAP
+
+
+
+    //QUEUE
     //CONSTRUCTOR
-    template<typename T> HashMap<T>::HashMap(int maxElementNumber): maxElementNumber(maxElementNumber) {
-        hashTable = std::vector<Bucket>(maxElementNumber);
+    //the buffer is allocated by the first enqueue
+    template<typename T> Queue<T>::Queue() noexcept: elements(nullptr), capacity(0), first(0), length(0) {}
 
-        for(int i = 0; i < maxElementNumber; i++) hashTable[i] = Bucket();
+    //COPY CONSTRUCTOR
+    //the elements are copied from the head, so the copy starts at the beginning of its buffer
+    template<typename T> Queue<T>::Queue(const Queue<T>& other): Queue() {
+        reserve(other.length);
+
+        for(int i = 0; i < other.length; i++) enqueue(other.getElement(i));
     }
-    
-    //CONSTRUCTOR
-    template<typename T> HashMap<T>::HashMap(): maxElementNumber(100) {
-        hashTable = std::vector<Bucket>(maxElementNumber);
 
-        for(int i = 0; i < maxElementNumber; i++) hashTable[i] = Bucket();
+    //MOVE CONSTRUCTOR
+    template<typename T> Queue<T>::Queue(Queue<T>&& other) noexcept: Queue() {
+        moveFrom(other);
+    }
+
+    //DESTRUCTOR
+    template<typename T> Queue<T>::~Queue() {
+        clear();
+        releaseBuffer();
+    }
+
+    //COPY ASSIGNMENT
+    template<typename T> Queue<T>& Queue<T>::operator=(const Queue<T>& other) {
+        if(this != &other) {
+            Queue<T> copy(other);
+
+            clear();
+            releaseBuffer();
+            moveFrom(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T> Queue<T>& Queue<T>::operator=(Queue<T>&& other) noexcept {
+        if(this != &other) {
+            clear();
+            releaseBuffer();
+            moveFrom(other);
+        }
+
+        return *this;
     }
 
 
 
 
     //METHODS
-    //it calculates the hash value of the string passed by argument
-    template<typename T> int HashMap<T>::calculateHashValue(const std::string& key) {
-        int sum = 0;
+    //returns the element at a position from the head of the queue
+    template<typename T> T& Queue<T>::getElement(int index) const noexcept {
+        return elements[(first + index) & (capacity - 1)];
+    }
 
-        for(char character : key) sum += (int)character;
-        
-        
-        return sum % maxElementNumber;
+    //takes the buffer of another queue, which must be empty without buffer, and leaves it empty
+    template<typename T> void Queue<T>::moveFrom(Queue<T>& other) noexcept {
+        std::swap(elements, other.elements);
+        std::swap(capacity, other.capacity);
+        std::swap(first, other.first);
+        std::swap(length, other.length);
     }
 
-    //adds a Pair to the hash map
-    template<typename T> void HashMap<T>::add(Pair<T> pair) {
-        const int hashValue = calculateHashValue(pair.getKey());
+    //frees the buffer, the queue must be empty
+    template<typename T> void Queue<T>::releaseBuffer() noexcept {
+        if(elements) std::allocator<T>().deallocate(elements, capacity);
+
+        elements = nullptr;
+        capacity = 0;
+        first = 0;
+    }
 
-        hashTable[hashValue].add(pair);  
-        hashMapKeys.add(pair.getKey());      
-    } 
+    //constructs an element in a buffer of double capacity and then moves the others into it, starting from the head.
+    //the new element is constructed first because the arguments may refer to an element of the old buffer
+    template<typename T> template<typename... Args> T& Queue<T>::growAndEmplace(Args&&... args) {
+        const int newCapacity = capacity ? capacity * 2 : minimumCapacity;
+        T* buffer = std::allocator<T>().allocate(newCapacity);
+        int moved = 0;
 
-    //removes a Pair from the hash map
-    template<typename T> void HashMap<T>::remove(std::string key) {
-        const int hashValue = calculateHashValue(key);
+        try {
+            new(&buffer[length]) T(std::forward<Args>(args)...);
+
+            try {
+                for(; moved < length; moved++) new(&buffer[moved]) T(std::move_if_noexcept(getElement(moved)));
+            }
+            catch(...) {
+                for(int i = 0; i < moved; i++) buffer[i].~T();
+
+                buffer[length].~T();
+                throw;
+            }
+        }
+        catch(...) {
+            std::allocator<T>().deallocate(buffer, newCapacity);
+            throw;
+        }
+
+
+        const int oldLength = length;
+
+        clear();
+        releaseBuffer();
+
+        elements = buffer;
+        capacity = newCapacity;
+        length = oldLength + 1;
+
+        return elements[length - 1];
+    }
+
+    //adds an element to the top of the queue
+    template<typename T> void Queue<T>::enqueue(const T& value) {
+        emplace(value);
+    }
+
+    //moves an element to the top of the queue
+    template<typename T> void Queue<T>::enqueue(T&& value) {
+        emplace(std::move(value));
+    }
+
+    //constructs an element in place at the top of the queue and returns its reference
+    template<typename T> template<typename... Args> T& Queue<T>::emplace(Args&&... args) {
+        if(length == capacity) return growAndEmplace(std::forward<Args>(args)...);
 
-        hashTable[hashValue].remove(key);
 
+        T* element = &getElement(length);
 
-        for(int i = 0; i < hashMapKeys.getLength(); i++) {
-            if(hashMapKeys[i] == key) {
-                hashMapKeys.remove(i);
+        new(element) T(std::forward<Args>(args)...);
+        length++;
+
+        return *element;
+    }
+
+    //adds count values to the top of the queue in their order. the buffer grows at most once and the values are
+    //written in the two runs before and after the end of the ring, as blocks if they're trivially copyable.
+    //values inside the queue are copied out before the buffer grows, and if a copy throws the queue is left as it was
+    template<typename T> void Queue<T>::enqueueBulk(const T* values, int count) {
+        if(count <= 0) return;
+
+        if(count > capacity - length) {
+            const bool inside = !std::less<const T*>()(values, elements) && std::less<const T*>()(values, elements + capacity);
+
+            if(inside) {
+                const std::vector<T> copy(values, values + count);
+
+                enqueueBulk(copy.data(), count);
                 return;
             }
+
+            reserve(length + count);
+        }
+
+
+        const int last = (first + length) & (capacity - 1);
+
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            const int firstRun = std::min(count, capacity - last);
+
+            std::memcpy(static_cast<void*>(elements + last), values, firstRun * sizeof(T));
+            std::memcpy(static_cast<void*>(elements), values + firstRun, (count - firstRun) * sizeof(T));
+            length += count;
+        }
+        else {
+            int added = 0;
+
+            try {
+                for(; added < count; added++) new(&elements[(last + added) & (capacity - 1)]) T(values[added]);
+            }
+            catch(...) {
+                while(added > 0) elements[(last + --added) & (capacity - 1)].~T();
+
+                throw;
+            }
+
+            length += count;
         }
     }
 
-    //returns a modifiable reference to the value associated with the specified key
-    template<typename T> T& HashMap<T>::operator[](std::string key) {
-        const int hashValue = calculateHashValue(key);
+    //removes the element at the bottom of the queue
+    template<typename T> void Queue<T>::dequeue() {
+        if(length == 0) return;
+
+
+        elements[first].~T();
+
+        first = (first + 1) & (capacity - 1);
+        length--;
+    }
+
+    //removes up to max elements from the head of the queue and moves them into values in order,
+    //returns the number of elements removed. the elements are move assigned, so values must hold at least max
+    //constructed elements. they're removed one at a time, so if an assignment throws the queue keeps the others
+    template<typename T> int Queue<T>::dequeueBulk(T* values, int max) {
+        const int count = std::min(std::max(max, 0), length);
+
+        if(count == 0) return 0;
+
+
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            const int firstRun = std::min(count, capacity - first);
+
+            std::memcpy(static_cast<void*>(values), elements + first, firstRun * sizeof(T));
+            std::memcpy(static_cast<void*>(values + firstRun), elements, (count - firstRun) * sizeof(T));
+
+            first = (first + count) & (capacity - 1);
+            length -= count;
+        }
+        else {
+            for(int i = 0; i < count; i++) {
+                values[i] = std::move(elements[first]);
+                dequeue();
+            }
+        }
+
+        return count;
+    }
+
+    //returns the reference of the element at the head of the queue
+    template<typename T> T& Queue<T>::head() {
+        if(length == 0) throw std::runtime_error("The Queue<T> is empty!");
+
+        return elements[first];
+    }
+
+    //makes room for the specified number of elements, the capacity stays a power of two
+    template<typename T> void Queue<T>::reserve(int elementNumber) {
+        if(elementNumber <= capacity) return;
+
+
+        int newCapacity = minimumCapacity;
+
+        while(newCapacity < elementNumber) newCapacity *= 2;
+
+
+        T* buffer = std::allocator<T>().allocate(newCapacity);
+        int moved = 0;
+
+        try {
+            for(; moved < length; moved++) new(&buffer[moved]) T(std::move_if_noexcept(getElement(moved)));
+        }
+        catch(...) {
+            for(int i = 0; i < moved; i++) buffer[i].~T();
+
+            std::allocator<T>().deallocate(buffer, newCapacity);
+            throw;
+        }
+
+
+        const int oldLength = length;
+
+        clear();
+        releaseBuffer();
+
+        elements = buffer;
+        capacity = newCapacity;
+        length = oldLength;
+    }
+
+    //destroys every element, the buffer is kept
+    template<typename T> void Queue<T>::clear() noexcept {
+        while(length > 0) dequeue();
+
+        first = 0;
+    }
+
+    //returns the number of elements of the queue
+    template<typename T> int Queue<T>::getLength() const noexcept {
+        return this->length;
+    }
+
+    //returns the number of elements the queue can hold before it grows
+    template<typename T> int Queue<T>::getCapacity() const noexcept {
+        return this->capacity;
+    }
+
+    //returns if the queue is empty or not
+    template<typename T> bool Queue<T>::isEmpty() const noexcept {
+        return length == 0;
+    }
+
+    //returns a string representing the queue with a forword verse, from the last element to the head
+    template<typename T> std::string Queue<T>::toString() {
+        return toString(Modality::Verse::forwords);
+    }
+
+    //returns a string representing the queue with the specified verse, backwards starts from the head
+    template<typename T> std::string Queue<T>::toString(Modality::Verse verse) {
+        std::string string = "[";
+
+        for(int i = 0; i < length; i++) {
+            const int index = (verse == Modality::Verse::forwords) ? length - 1 - i : i;
+
+            string += std::to_string(getElement(index)) + ((i == length - 1) ? "" : ", ");
+        }
+
+
+        string += "]";
+        return string;
+    }
+
+
+    #pragma endregion
+
+    #pragma region CONCURRENTQUEUE
+    //waits a little before a blocked operation tries again: the first attempts only pause
+    //the processor, then the thread yields to the others
+    inline void backoff(int& attempt) noexcept {
+        if(attempt++ < 64) {
+            #if defined(__SSE2__) || defined(_M_X64)
+                _mm_pause();
+            #endif
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+
+
+    //SPSCQueue<T> class definition
+    //bounded lock-free queue between a single producer thread and a single consumer thread, built on a ring
+    //whose capacity is a power of two. each side writes only its own index, which is on its own cache line with
+    //the last index it has read from the other side, so the two threads touch the other line only when the cached
+    //index says the ring looks full or empty
+    template<typename T> class SPSCQueue final {
+        private:
+            struct alignas(T) Slot {
+                unsigned char storage[sizeof(T)];
+            };
 
-        return hashTable[hashValue][key];
-    }
 
-    //checks if a key exist in the hash map
-    template<typename T> bool HashMap<T>::exist(std::string key) {
-        const int hashValue = calculateHashValue(key);
+            std::unique_ptr<Slot[]> slots;
+            std::size_t mask;
 
-        return hashTable[hashValue].exist(key);
-    }
+            //written by the producer
+            alignas(64) std::atomic<std::size_t> tail;
+            std::size_t cachedHead;
 
-    //returns the std::string represents the hash map with the association key: value
-    template<typename T> std::string HashMap<T>::toString() {
-        std::string stringFormat = "{\n";
+            //written by the consumer
+            alignas(64) std::atomic<std::size_t> headPosition;
+            std::size_t cachedTail;
 
-        for(auto& bucket : hashTable) stringFormat += bucket.toString();
-        
 
-        stringFormat += "}\n";
+            T& getElement(std::size_t) const noexcept;
 
-        return stringFormat;
-    }
 
-    //returns the string representing the hash map with the specified association
-    template<typename T> std::string HashMap<T>::toString(Modality::Association association) {
-        if(association == Modality::Association::keyValue) {
-            return this->toString();
-        }
-        else {
-            std::string stringFormat = "{\n";
+        public:
+            template<typename... Args> bool tryEmplace(Args&&...);
+            bool tryEnqueue(const T&);
+            bool tryEnqueue(T&&);
+            void enqueue(const T&);
+            void enqueue(T&&);
+            bool tryDequeue(T&);
+            void dequeue(T&);
+            T& head(void);
+            int getLength(void) const noexcept;
+            int getCapacity(void) const noexcept;
+            bool isEmpty(void) const noexcept;
 
-            for(auto& bucket : hashTable) stringFormat += bucket.toString(association);
 
+            SPSCQueue(const SPSCQueue<T>&) = delete;
+            SPSCQueue<T>& operator=(const SPSCQueue<T>&) = delete;
 
-            stringFormat += "\n}";
-            return stringFormat;
-        }
-    }
+            explicit SPSCQueue(int);
+            SPSCQueue(void);
+            ~SPSCQueue(void);
+    };
 
-    //returns a vector of the keys of the hash map
-    template<typename T> std::vector<std::string> HashMap<T>::getKeys() {
-        std::vector<std::string> keysVector;
 
-        for(int i = 0; i < hashMapKeys.getLength(); i++) {
-            keysVector.push_back(hashMapKeys[i]);
-        }
+    //MPMCQueue<T> class definition
+    //bounded lock-free queue for any number of producers and consumers (D. Vyukov's design). every cell of the
+    //ring has a sequence number that tells whose turn it is: a producer at position p waits for sequence p,
+    //fills the cell and sets p + 1, a consumer at p waits for p + 1, empties the cell and sets p + capacity for
+    //the producer of the next lap. a position is claimed with a compare and swap on the shared index, then the
+    //cell is used without further synchronization.
+    //a claimed cell must always be released, so the values must be moved without exceptions
+    template<typename T> class MPMCQueue final {
+        private:
+            struct Cell {
+                std::atomic<std::size_t> sequence;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
 
 
+            static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "The values of a MPMCQueue<T> must be moved without exceptions!");
 
-        return keysVector;
-    }
 
-    //returns the reference of all the pairs in the hash map
-    template<typename T> std::vector<Pair<T>*> HashMap<T>::getPairs() {
-        std::vector<Pair<T>*> pairs;
 
 
-        for(auto& bucket : hashTable) {
-            std::vector<Pair<T>*> bucketPairs = bucket.getPairs();
-            pairs.insert(pairs.end(), bucketPairs.begin(), bucketPairs.end());
-        }
+            std::unique_ptr<Cell[]> cells;
+            std::size_t mask;
+            alignas(64) std::atomic<std::size_t> enqueuePosition;
+            alignas(64) std::atomic<std::size_t> dequeuePosition;
 
 
-        return pairs;
-    }
+            static T& getElement(Cell&) noexcept;
+            bool tryPush(T&) noexcept;
 
 
+        public:
+            template<typename... Args> bool tryEmplace(Args&&...);
+            bool tryEnqueue(const T&);
+            bool tryEnqueue(T&&);
+            void enqueue(const T&);
+            void enqueue(T&&);
+            bool tryDequeue(T&);
+            void dequeue(T&);
+            int getLength(void) const noexcept;
+            int getCapacity(void) const noexcept;
+            bool isEmpty(void) const noexcept;
 
 
+            MPMCQueue(const MPMCQueue<T>&) = delete;
+            MPMCQueue<T>& operator=(const MPMCQueue<T>&) = delete;
 
+            explicit MPMCQueue(int);
+            MPMCQueue(void);
+            ~MPMCQueue(void);
+    };
 
 
 
 
-    //BUCKET
-    //CONSTRUCTOR
-    template<typename T> HashMap<T>::Bucket::Bucket(): bucket() {}
 
 
+    //SPSCQUEUE
+    //CONSTRUCTOR
+    //capacity is rounded up to a power of two of at least 2, so a capacity of 1 holds 2 elements
+    template<typename T> SPSCQueue<T>::SPSCQueue(int capacity): mask(1), tail(0), cachedHead(0), headPosition(0), cachedTail(0) {
+        if(capacity <= 0) throw std::runtime_error("The capacity of a SPSCQueue<T> must be positive!");
 
 
-    //METHODS
-    //add a Pair<T> into a Bucket
-    template<typename T> void HashMap<T>::Bucket::add(Pair<T>& pair) {
-        if(bucket.getLength() != 0) {
-            for(int i = 0; i < bucket.getLength(); i++) {
-                if(pair.getKey() == bucket[i].getKey()) throw std::runtime_error("A pair with the key \"" + pair.getKey() + "\" already exist!");
-            }
-        }
+        std::size_t slotNumber = 2;
 
+        while(slotNumber < static_cast<std::size_t>(capacity)) slotNumber <<= 1;
 
-        bucket.add(pair);
+        slots.reset(new Slot[slotNumber]);
+        mask = slotNumber - 1;
     }
 
-    //removes a pair from the bucket
-    template<typename T> void HashMap<T>::Bucket::remove(std::string& key) {
-        if(bucket.getLength() == 0) throw std::runtime_error("The Pair<T> you're trying to remove doesn't exist!");
+    //CONSTRUCTOR
+    template<typename T> SPSCQueue<T>::SPSCQueue(): SPSCQueue(1024) {}
 
+    //DESTRUCTOR
+    template<typename T> SPSCQueue<T>::~SPSCQueue() {
+        const std::size_t last = tail.load(std::memory_order_acquire);
 
-        for(int i = 0; i < bucket.getLength(); i++) {
-            if(bucket[i].getKey() == key) {
-                bucket.remove(i);
-                return;
-            }
-        }
-                
-        throw std::runtime_error("The Pair<T> you're trying to remove doesn't exist!");
+        for(std::size_t i = headPosition.load(std::memory_order_acquire); i != last; i++) getElement(i).~T();
     }
 
-    //returns a modifiable reference to the value associated with the specified key found in the bucket
-    template<typename T> T& HashMap<T>::Bucket::operator[](std::string& key) {
-        if(bucket.getLength() == 0) throw std::runtime_error("There is no value associated with the key \"" + key + "\" in the HashMap<T>!");
 
 
-        for(int i = 0; i < bucket.getLength(); i++) {
-            if(bucket[i].getKey() == key) return bucket[i].getValue();
-        }
 
-        throw std::runtime_error("There is no value associated with the key \"" + key + "\" in the HashMap<T>!");
+    //METHODS
+    //returns the element at a position of the ring
+    template<typename T> T& SPSCQueue<T>::getElement(std::size_t position) const noexcept {
+        return *std::launder(reinterpret_cast<T*>(slots[position & mask].storage));
     }
 
-    //checks if a key exist inside a bucket
-    template<typename T> bool HashMap<T>::Bucket::exist(std::string& key) {
-        if(bucket.getLength() == 0) return false;
+    //constructs an element at the top of the queue, returns false if the queue is full. called only by the producer
+    template<typename T> template<typename... Args> bool SPSCQueue<T>::tryEmplace(Args&&... args) {
+        const std::size_t position = tail.load(std::memory_order_relaxed);
 
+        if(position - cachedHead > mask) {
+            cachedHead = headPosition.load(std::memory_order_acquire);
 
-        for(int i = 0; i < bucket.getLength(); i++) {
-            if(bucket[i].getKey() == key) return true;
+            if(position - cachedHead > mask) return false;
         }
 
-        return false;
-    }
-
-    //returns the string representing the bucket with the key: value association
-    template<typename T> std::string HashMap<T>::Bucket::toString() {
-        if(bucket.getLength() == 0) return "";
 
+        new(slots[position & mask].storage) T(std::forward<Args>(args)...);
+        tail.store(position + 1, std::memory_order_release);
 
-        std::string stringFormat = "";
-
-        for(int i = 0; i < bucket.getLength(); i++) stringFormat += bucket[i].toString();
-
-        return stringFormat;
+        return true;
     }
 
-    //returns the string representing the bucket with the specified association
-    template<typename T> std::string HashMap<T>::Bucket::toString(Modality::Association association) {
-        if(bucket.getLength() == 0) return "";
-
-
-        if(association == Modality::Association::keyValue) {
-            return this->toString();
-        }
-        else {
-            std::string stringFormat = "";
+    //adds an element to the top of the queue, returns false if the queue is full
+    template<typename T> bool SPSCQueue<T>::tryEnqueue(const T& value) {
+        return tryEmplace(value);
+    }
 
-            for(int i = 0; i < bucket.getLength(); i++) stringFormat += bucket[i].toString(association);
-    
-            return stringFormat;
-        }
+    //moves an element to the top of the queue, returns false if the queue is full
+    template<typename T> bool SPSCQueue<T>::tryEnqueue(T&& value) {
+        return tryEmplace(std::move(value));
     }
 
-    //returns the reference of all the pairs in the bucket
-    template<typename T> std::vector<Pair<T>*> HashMap<T>::Bucket::getPairs() {
-        std::vector<Pair<T>*> pairs;
+    //adds an element to the top of the queue, waiting while the queue is full
+    template<typename T> void SPSCQueue<T>::enqueue(const T& value) {
+        int attempt = 0;
 
-        for(int i = 0; i < bucket.getLength(); i++) pairs.push_back(&bucket[i]);
+        while(!tryEmplace(value)) backoff(attempt);
+    }
 
+    //moves an element to the top of the queue, waiting while the queue is full
+    template<typename T> void SPSCQueue<T>::enqueue(T&& value) {
+        int attempt = 0;
 
-        return pairs;
+        while(!tryEmplace(std::move(value))) backoff(attempt);
     }
 
+    //moves the element at the head of the queue into value and removes it, returns false if the queue is empty.
+    //called only by the consumer
+    template<typename T> bool SPSCQueue<T>::tryDequeue(T& value) {
+        const std::size_t position = headPosition.load(std::memory_order_relaxed);
 
+        if(position == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
 
+            if(position == cachedTail) return false;
+        }
 
 
+        T& element = getElement(position);
 
+        value = std::move(element);
+        element.~T();
+        headPosition.store(position + 1, std::memory_order_release);
 
+        return true;
+    }
 
+    //moves the element at the head of the queue into value and removes it, waiting while the queue is empty
+    template<typename T> void SPSCQueue<T>::dequeue(T& value) {
+        int attempt = 0;
 
-    //PAIR
-    //CONSTRUCTOR
-    template<typename T> Pair<T>::Pair(std::string key, T value): key(key) {
-        setValue(value);
+        while(!tryDequeue(value)) backoff(attempt);
     }
 
+    //returns the reference of the element at the head of the queue, it stays valid until the consumer dequeues it
+    template<typename T> T& SPSCQueue<T>::head() {
+        const std::size_t position = headPosition.load(std::memory_order_relaxed);
 
+        if(position == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
 
+            if(position == cachedTail) throw std::runtime_error("The SPSCQueue<T> is empty!");
+        }
 
-    //METHODS
-    //it returns the key of a Pair
-    template<typename T> const std::string Pair<T>::getKey() const noexcept {
-        return this->key;
+        return getElement(position);
     }
 
-    //it returns the value of a Pair
-    template<typename T> T& Pair<T>::getValue() noexcept {
-        return this->value;
-    }
+    //returns the number of elements of the queue, it may be changed at once by the other thread
+    template<typename T> int SPSCQueue<T>::getLength() const noexcept {
+        const std::size_t first = headPosition.load(std::memory_order_acquire);
 
-    //it sets the value of a Pair
-    template<typename T> void Pair<T>::setValue(T value) {
-        try {
-            this->value = value;
-        }
-        catch(...) {
-            std::cout<< "Cannot assign the value to Pair<T>::value or print out the value you're trying to assign and the value of Pair<T>::value.";
-        }
+        return static_cast<int>(tail.load(std::memory_order_acquire) - first);
     }
 
-    //returns the string representing a pair with the key: value association
-    template<typename T> std::string Pair<T>::toString() {
-        try {
-            return "\t{\"" + this->key + "\": " + std::to_string(this->value) + "}\n";
-        }
-        catch(...) {
-            return "It's impossible to display a string format of this HashMap<T> because of the type of it's value";
-        }
+    //returns the maximum number of elements of the queue
+    template<typename T> int SPSCQueue<T>::getCapacity() const noexcept {
+        return static_cast<int>(mask + 1);
     }
 
-    //returns the string representing a pair with the specified association
-    template<typename T> std::string Pair<T>::toString(Modality::Association association) {
-        if(association == Modality::Association::keyValue) {
-            return this->toString();
-        }
-        else {
-            try {
-                return "\t{\"" + std::to_string(this->value) + "\": " + this->key + "}\n";
-            }
-            catch(...) {
-                return "It's impossible to display a string format of this HashMap<T> because of the type of it's value";
-            }
-        }
+    //returns if the queue is empty or not
+    template<typename T> bool SPSCQueue<T>::isEmpty() const noexcept {
+        return getLength() == 0;
     }
-    
-    #pragma endregion
 
-    #pragma region STACK
-    //Stack<T> class definition
-    //it manipulates a List<T> object to make it work like a stack
-    template<typename T> class Stack final {
-        private:
-            List<T> list;
 
-        public:
-            void push(T);
-            void pop(void);
-            T& top(void);
-            int getLength(void) const noexcept;
-            bool isEmpty(void) const noexcept;
-            std::string toString(void);
-            std::string toString(Modality::Direction);
-    };
 
 
 
 
 
 
+    //MPMCQUEUE
+    //CONSTRUCTOR
+    //capacity is rounded up to a power of two of at least 2, so a capacity of 1 holds 2 elements
+    template<typename T> MPMCQueue<T>::MPMCQueue(int capacity): mask(1), enqueuePosition(0), dequeuePosition(0) {
+        if(capacity <= 0) throw std::runtime_error("The capacity of a MPMCQueue<T> must be positive!");
 
 
-    //METHODS
-    //add an element on top of the stack
-    template<typename T> void Stack<T>::push(T value) {
-        list.add(value);
-    }
+        std::size_t cellNumber = 2;
 
-    //pops the top element of the stack
-    template<typename T> void Stack<T>::pop() {
-        list.remove();
-    }
+        while(cellNumber < static_cast<std::size_t>(capacity)) cellNumber <<= 1;
 
-    //retuns the reference to the top element of the stack
-    template<typename T> T& Stack<T>::top() {
-        return list[list.getLength() - 1];
-    }
+        cells.reset(new Cell[cellNumber]);
+        mask = cellNumber - 1;
 
-    //retuns the number of elements in the stack
-    template<typename T> int Stack<T>::getLength() const noexcept {
-        return list.getLength();
+        for(std::size_t i = 0; i < cellNumber; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
     }
 
-    //returns if the stack is empty or not
-    template<typename T> bool Stack<T>::isEmpty() const noexcept {
-        return (list.getLength() != 0) ? false : true;
-    }
+    //CONSTRUCTOR
+    template<typename T> MPMCQueue<T>::MPMCQueue(): MPMCQueue(1024) {}
 
-    //returns a string representing the stack from top to bottom
-    template<typename T> std::string Stack<T>::toString() {
-        std::string stack = "________\n";
+    //DESTRUCTOR
+    template<typename T> MPMCQueue<T>::~MPMCQueue() {
+        const std::size_t last = enqueuePosition.load(std::memory_order_acquire);
 
-        try {
-            for(int i = -1; i > -list.getLength() - 1; i--) 
-                stack += std::to_string(list[i]) + "\n";
-        }
-        catch(...) {
-            std::cerr<< "The value you're trying to represent can't be converted into a string!";
-        }
-        
-    
-        
-        return stack;
+        for(std::size_t i = dequeuePosition.load(std::memory_order_acquire); i != last; i++) getElement(cells[i & mask]).~T();
     }
 
-    //returns a string representing the stack in a specified direction
-    template<typename T> std::string Stack<T>::toString(Modality::Direction direction) {
-        try {
-            if(direction == Modality::Direction::topToBottom) {
-                return this->toString();
-            }
-            else {
-                std::string stack = "________\n";
 
 
-                for(int i = 0; i < list.getLength(); i++) 
-                    stack += std::to_string(list[i]) + "\n";
 
+    //METHODS
+    //returns the element stored in a cell
+    template<typename T> T& MPMCQueue<T>::getElement(Cell& cell) noexcept {
+        return *std::launder(reinterpret_cast<T*>(cell.storage));
+    }
 
-                return stack;
+    //claims the next cell and moves value into it, returns false without touching value if the queue is full
+    template<typename T> bool MPMCQueue<T>::tryPush(T& value) noexcept {
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while(true) {
+            cell = &cells[position & mask];
+
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if(difference == 0) {
+                if(enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+            }
+            else if(difference < 0) {
+                return false;
+            }
+            else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
             }
         }
-        catch(...) {
-            std::cerr<< "The value you're trying to represent can't be converted into a string!";
-            return "";
-        }
+
+
+        new(cell->storage) T(std::move(value));
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
     }
 
+    //constructs an element at the top of the queue, returns false if the queue is full.
+    //the element is constructed before a cell is claimed, so a throwing constructor leaves the queue as it was
+    template<typename T> template<typename... Args> bool MPMCQueue<T>::tryEmplace(Args&&... args) {
+        T value(std::forward<Args>(args)...);
 
+        return tryPush(value);
+    }
 
+    //adds an element to the top of the queue, returns false if the queue is full
+    template<typename T> bool MPMCQueue<T>::tryEnqueue(const T& value) {
+        T copy(value);
 
-    #pragma endregion
+        return tryPush(copy);
+    }
 
-    #pragma region QUEUE
+    //moves an element to the top of the queue, returns false (and leaves the value as it was) if the queue is full
+    template<typename T> bool MPMCQueue<T>::tryEnqueue(T&& value) {
+        return tryPush(value);
+    }
 
-    //Queue<T> class definition
-    //manululates a List<T> object to make it work like a queue
-    template<typename T> class Queue final {
-        private:
-            List<T> list;
+    //adds an element to the top of the queue, waiting while the queue is full
+    template<typename T> void MPMCQueue<T>::enqueue(const T& value) {
+        T copy(value);
+        int attempt = 0;
 
-        
-        public:
-            void enqueue(T);
-            void dequeue(void);
-            T& head(void);
-            int getLength(void) const noexcept;
-            bool isEmpty(void) const noexcept;
-            std::string toString(void);
-            std::string toString(Modality::Verse);
-    };
+        while(!tryPush(copy)) backoff(attempt);
+    }
 
+    //moves an element to the top of the queue, waiting while the queue is full
+    template<typename T> void MPMCQueue<T>::enqueue(T&& value) {
+        int attempt = 0;
 
+        while(!tryPush(value)) backoff(attempt);
+    }
 
+    //moves the element at the head of the queue into value and removes it, returns false if the queue is empty
+    template<typename T> bool MPMCQueue<T>::tryDequeue(T& value) {
+        std::size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
 
+        while(true) {
+            cell = &cells[position & mask];
 
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
 
+            if(difference == 0) {
+                if(dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+            }
+            else if(difference < 0) {
+                return false;
+            }
+            else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
 
 
+        T& element = getElement(*cell);
 
-    //METHODS
-    //adds an element to the top of the queue
-    template<typename T> void Queue<T>::enqueue(T value) {
-        list.add(value, list.getLength());
-    }
+        value = std::move(element);
+        element.~T();
+        cell->sequence.store(position + mask + 1, std::memory_order_release);
 
-    //removes the element at the bottom of the queue
-    template<typename T> void Queue<T>::dequeue() {
-        list.remove(0);
+        return true;
     }
 
-    //returns the reference of the element at the head of the queue
-    template<typename T> T& Queue<T>::head() {
-        return list[0];
-    }
+    //moves the element at the head of the queue into value and removes it, waiting while the queue is empty
+    template<typename T> void MPMCQueue<T>::dequeue(T& value) {
+        int attempt = 0;
 
-    //returns the number of elements of the queue
-    template<typename T> int Queue<T>::getLength() const noexcept {
-        return list.getLength();
+        while(!tryDequeue(value)) backoff(attempt);
     }
 
-    //returns if the queue is empty or not
-    template<typename T> bool Queue<T>::isEmpty() const noexcept {
-        return (list.getLength() != 0) ? false : true;
-    }
+    //returns the number of elements of the queue, it may be changed at once by another thread
+    template<typename T> int MPMCQueue<T>::getLength() const noexcept {
+        const std::size_t first = dequeuePosition.load(std::memory_order_acquire);
+        const std::size_t last = enqueuePosition.load(std::memory_order_acquire);
 
-    //returns a string representing the queue with a forword verse
-    template<typename T> std::string Queue<T>::toString() {
-        return list.toString(Modality::Verse::backwards);
+        return last > first ? static_cast<int>(last - first) : 0;
     }
 
-    //returns a string representing the queue with the specified verse
-    template<typename T> std::string Queue<T>::toString(Modality::Verse verse) {
-        return list.toString((Modality::Verse)-verse);
+    //returns the maximum number of elements of the queue
+    template<typename T> int MPMCQueue<T>::getCapacity() const noexcept {
+        return static_cast<int>(mask + 1);
     }
 
+    //returns if the queue is empty or not
+    template<typename T> bool MPMCQueue<T>::isEmpty() const noexcept {
+        return getLength() == 0;
+    }
 
     #pragma endregion
 
+
     #pragma region AVLTREE
     //AVLTree<T> class definition
     template<typename T> class AVLTree final {
@@ -908,8 +6824,10 @@ namespace DSA {
                     T value;
             
                 public:
-                    T getValue(void) const noexcept;
-                    void setValue(T);
+                    const T& getValue(void) const noexcept;
+                    T& getValue(void) noexcept;
+                    void setValue(const T&);
+                    void setValue(T&&);
                     
             
                     Node* left;
@@ -918,10 +6836,14 @@ namespace DSA {
             
             
                     Node(void) = default;
-                    Node(T);
+                    Node(const T&);
+                    Node(T&&);
             };
 
 
+            //an AVL tree as high as this has billions of nodes, so the paths kept by add and remove never allocate
+            static constexpr int maximumPathLength = 48;
+
 
 
     
@@ -942,18 +6864,29 @@ namespace DSA {
             bool isBalanced(Node*);
             void replaceNode(Node*, Node*, Node*);
             void deleteNodes(Node*);
+            Node* copyNodes(const Node*);
     
         
         public:
             void traverse(Modality::Traverse);
             void traverse(void);
             bool isBalanced(void);
-            void remove(T);
-            void add(T);
+            void remove(const T&);
+            void add(const T&);
+            void add(T&&);
+            template<typename... Args> void emplace(Args&&...);
+            void swap(AVLTree<T>&) noexcept;
+            AVLTree<T> clone(void) const;
             Node getRootCopy(void);
+
+
+            AVLTree<T>& operator=(const AVLTree<T>&);
+            AVLTree<T>& operator=(AVLTree<T>&&) noexcept;
     
     
             AVLTree(void);
+            AVLTree(const AVLTree<T>&);
+            AVLTree(AVLTree<T>&&) noexcept;
             ~AVLTree(void);
     };
     
@@ -971,11 +6904,44 @@ namespace DSA {
         this->root = nullptr;
     }
 
+    //COPY CONSTRUCTOR
+    //rebuilds the same shape of the other tree, so no rebalancing is needed
+    template<typename T> AVLTree<T>::AVLTree(const AVLTree<T>& other) {
+        this->root = copyNodes(other.root);
+    }
+
+    //MOVE CONSTRUCTOR
+    template<typename T> AVLTree<T>::AVLTree(AVLTree<T>&& other) noexcept {
+        this->root = other.root;
+        other.root = nullptr;
+    }
+
     //DESTRUCTOR
     template<typename T> AVLTree<T>::~AVLTree() {
         deleteNodes(root);
         root = nullptr;
     }
+
+    //COPY ASSIGNMENT
+    template<typename T> AVLTree<T>& AVLTree<T>::operator=(const AVLTree<T>& other) {
+        if(this != &other) {
+            AVLTree<T> copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    //MOVE ASSIGNMENT
+    template<typename T> AVLTree<T>& AVLTree<T>::operator=(AVLTree<T>&& other) noexcept {
+        if(this != &other) {
+            deleteNodes(root);
+            root = other.root;
+            other.root = nullptr;
+        }
+
+        return *this;
+    }
     
     //METHODS
     //deletes all nodes of the tree recursively
@@ -983,8 +6949,39 @@ namespace DSA {
         if(!node) return;
 
         deleteNodes(node->left);
-        delete node;
         deleteNodes(node->right);
+        delete node;
+    }
+
+    //copies a subtree in pre-order keeping the heights of the nodes, so the copy is already balanced
+    template<typename T> typename AVLTree<T>::Node* AVLTree<T>::copyNodes(const Node* node) {
+        if(!node) return nullptr;
+
+
+        Node* copy = new Node(node->getValue());
+        copy->height = node->height;
+
+        try {
+            copy->left = copyNodes(node->left);
+            copy->right = copyNodes(node->right);
+        }
+        catch(...) {
+            deleteNodes(copy);
+            throw;
+        }
+
+
+        return copy;
+    }
+
+    //exchanges the content of two trees in constant time
+    template<typename T> void AVLTree<T>::swap(AVLTree<T>& other) noexcept {
+        std::swap(root, other.root);
+    }
+
+    //returns a copy of the tree made with a single pre-order pass
+    template<typename T> AVLTree<T> AVLTree<T>::clone() const {
+        return AVLTree<T>(*this);
     }
 
     //returns the balance factor of a node
@@ -1118,15 +7115,25 @@ namespace DSA {
         std::cout<< node->getValue() << ", ";
     }
 
-    //inserts a node inside the tree
-    template<typename T> void AVLTree<T>::add(T value) {
+    //inserts a copy of a value inside the tree
+    template<typename T> void AVLTree<T>::add(const T& value) {
+        add(T(value));
+    }
+
+    //constructs a value from the arguments and moves it inside the tree
+    template<typename T> template<typename... Args> void AVLTree<T>::emplace(Args&&... args) {
+        add(T(std::forward<Args>(args)...));
+    }
+
+    //inserts a node inside the tree moving the value into it
+    template<typename T> void AVLTree<T>::add(T&& value) {
         //if root node isn't instantiated it instantiates it
         if(!root) {
-            root = new Node(value);
+            root = new Node(std::move(value));
             return;
         }
     
-        Stack<Node*> traversedNodes;
+        Stack<Node*, maximumPathLength> traversedNodes;
         Node* node = root;
     
     
@@ -1146,7 +7153,7 @@ namespace DSA {
                 }
                 else {
                     //inserts the node
-                    node->left = new Node(value);
+                    node->left = new Node(std::move(value));
                     traversedNodes.push(node->left);
                     break;
                 }
@@ -1158,7 +7165,7 @@ namespace DSA {
                 }
                 else {
                     //inserts the node
-                    node->right = new Node(value);
+                    node->right = new Node(std::move(value));
                     traversedNodes.push(node->right);
                     break;
                 }
@@ -1224,10 +7231,10 @@ namespace DSA {
     }
     
     //deletes a node of the tree
-    template<typename T> void AVLTree<T>::remove(T value) {
+    template<typename T> void AVLTree<T>::remove(const T& value) {
         Node* node = root;
         Node* parent = nullptr;
-        Stack<Node*> traversedNodes;
+        Stack<Node*, maximumPathLength> traversedNodes;
     
     
         //finds the parent of the node to delete and pushes every node that it goes through into a deque (front)
@@ -1302,7 +7309,7 @@ namespace DSA {
     
     
             //changes the value of the node to delete with its in-order successor's value
-            node->setValue(successor->getValue());
+            node->setValue(std::move(successor->getValue()));
     
     
     
@@ -1373,8 +7380,14 @@ namespace DSA {
     
     //NODE
     //CONSTRUCTOR
-    template<typename T> AVLTree<T>::Node::Node(T value) {
-        setValue(value);
+    template<typename T> AVLTree<T>::Node::Node(const T& value): value(value) {
+        this->height = 1;
+        this->left = nullptr;
+        this->right = nullptr;
+    }
+
+    //CONSTRUCTOR
+    template<typename T> AVLTree<T>::Node::Node(T&& value): value(std::move(value)) {
         this->height = 1;
         this->left = nullptr;
         this->right = nullptr;
@@ -1383,18 +7396,23 @@ namespace DSA {
     
     //METHODS
     //returns the value of the node
-    template<typename T> T AVLTree<T>::Node::getValue() const noexcept {
+    template<typename T> const T& AVLTree<T>::Node::getValue() const noexcept {
+        return this->value;
+    }
+
+    //returns the modifiable value of the node
+    template<typename T> T& AVLTree<T>::Node::getValue() noexcept {
         return this->value;
     }
     
-    //sets the value of the node or throws an exception if the type doesn't correspond or if the value cannot be printed
-    template<typename T> void AVLTree<T>::Node::setValue(T value) {
-        try {
-            this->value = value;
-        }
-        catch(...) {
-            std::cout<< "Cannot assign the value to AVLTree<T>::Node::value or print out the value you're trying to assign and the value of AVLTree<T>::Node::value.";
-        }
+    //sets the value of the node
+    template<typename T> void AVLTree<T>::Node::setValue(const T& value) {
+        this->value = value;
+    }
+
+    //sets the value of the node moving it
+    template<typename T> void AVLTree<T>::Node::setValue(T&& value) {
+        this->value = std::move(value);
     }
 
 
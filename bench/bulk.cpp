@@ -0,0 +1,71 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <vector>
+
+
+
+
+//moves the same values through the container one at a time and in batches, returns nanoseconds per element
+template<typename Container, typename Single, typename Bulk> void run(const char* name, Single&& single, Bulk&& bulk) {
+    const int batch = 256;
+    const int rounds = 20000;
+
+    Container container;
+    std::vector<int> values(batch);
+
+    for(int i = 0; i < batch; i++) values[i] = i;
+
+    container.reserve(batch);
+
+
+    const double singleTime = Timer::milliseconds([&]() {
+        for(int round = 0; round < rounds; round++) single(container, values.data(), batch);
+    });
+
+    const double bulkTime = Timer::milliseconds([&]() {
+        for(int round = 0; round < rounds; round++) bulk(container, values.data(), batch);
+    });
+
+    Timer::keep(values);
+
+
+    const double elements = double(rounds) * batch;
+
+    std::printf("%-11s batches of %d ints: one at a time %5.2f ns per element, bulk %5.2f ns\n", name, batch, singleTime * 1e6 / elements, bulkTime * 1e6 / elements);
+}
+
+
+
+
+int main() {
+    run<DSA::Queue<int>>("Queue<int>",
+        [](DSA::Queue<int>& queue, int* values, int count) {
+            for(int i = 0; i < count; i++) queue.enqueue(values[i]);
+
+            for(int i = 0; i < count; i++) {
+                values[i] = queue.head();
+                queue.dequeue();
+            }
+        },
+        [](DSA::Queue<int>& queue, int* values, int count) {
+            queue.enqueueBulk(values, count);
+            queue.dequeueBulk(values, count);
+        });
+
+    run<DSA::Stack<int>>("Stack<int>",
+        [](DSA::Stack<int>& stack, int* values, int count) {
+            for(int i = 0; i < count; i++) stack.push(values[i]);
+
+            for(int i = count - 1; i >= 0; i--) {
+                values[i] = stack.top();
+                stack.pop();
+            }
+        },
+        [](DSA::Stack<int>& stack, int* values, int count) {
+            stack.pushBulk(values, count);
+            stack.popBulk(values, count);
+        });
+
+    return 0;
+}
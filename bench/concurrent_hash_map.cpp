@@ -0,0 +1,78 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+
+
+//the baseline, a single HashMap behind a single mutex
+struct LockedHashMap final {
+    std::mutex mutex;
+    DSA::HashMap<int, int> map;
+};
+
+
+//splits the operations between the threads, every operation is a read with the given probability or a write
+template<typename Operation> double run(int threadNumber, int operationNumber, int keyNumber, int readPercentage, Operation&& operation) {
+    return Timer::milliseconds([&]() {
+        std::vector<std::thread> threads;
+
+        for(int thread = 0; thread < threadNumber; thread++) {
+            threads.emplace_back([&, thread]() {
+                std::mt19937 random(thread);
+
+                for(int i = 0; i < operationNumber / threadNumber; i++) {
+                    const int key = int(random() % keyNumber);
+                    operation(key, int(random() % 100) < readPercentage);
+                }
+            });
+        }
+
+        for(std::thread& thread : threads) thread.join();
+    });
+}
+
+
+
+
+int main() {
+    const int operationNumber = 400000;
+    const int keyNumber = 100000;
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+
+
+    for(int readPercentage : {90, 50, 10}) {
+        for(int threadNumber : {1, 2, 4, 8}) {
+            DSA::ConcurrentHashMap<int, int> sharded;
+            LockedHashMap locked;
+
+            for(int key = 0; key < keyNumber; key++) {
+                sharded.insertOrAssign(key, key);
+                locked.map.emplace(key, key);
+            }
+
+
+            const double shardedTime = run(threadNumber, operationNumber, keyNumber, readPercentage, [&](int key, bool read) {
+                if(read) Timer::keep(sharded.get(key));
+                else sharded.insertOrAssign(key, key + 1);
+            });
+
+            const double lockedTime = run(threadNumber, operationNumber, keyNumber, readPercentage, [&](int key, bool read) {
+                std::lock_guard<std::mutex> lock(locked.mutex);
+
+                if(read) Timer::keep(locked.map.exist(key));
+                else locked.map.insertOrAssign(key, key + 1);
+            });
+
+
+            std::printf("%3d%% reads, %d threads: ConcurrentHashMap %7.1f ms, HashMap with a mutex %7.1f ms\n", readPercentage, threadNumber, shardedTime, lockedTime);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+
+
+//the baseline: a Queue behind a mutex, the consumer sleeps on a condition variable while it is empty
+struct LockedQueue {
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    DSA::Queue<long> queue;
+
+    void enqueue(long value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.enqueue(value);
+        }
+
+        notEmpty.notify_one();
+    }
+
+    void dequeue(long& value) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this]() { return !queue.isEmpty(); });
+
+        value = queue.head();
+        queue.dequeue();
+    }
+};
+
+
+//one producer streams values to one consumer, returns nanoseconds per value
+template<typename Queue> double throughput(Queue& queue, long valueNumber) {
+    return Timer::milliseconds([&]() {
+        std::thread consumer([&]() {
+            long value = 0;
+
+            for(long i = 0; i < valueNumber; i++) queue.dequeue(value);
+
+            Timer::keep(value);
+        });
+
+        for(long i = 0; i < valueNumber; i++) queue.enqueue(i);
+
+        consumer.join();
+    }) * 1e6 / valueNumber;
+}
+
+//a value goes to the other thread and back, returns nanoseconds per round trip
+template<typename Queue> double roundTrip(Queue& forward, Queue& backward, long valueNumber) {
+    return Timer::milliseconds([&]() {
+        std::thread echo([&]() {
+            long value;
+
+            for(long i = 0; i < valueNumber; i++) {
+                forward.dequeue(value);
+                backward.enqueue(value);
+            }
+        });
+
+        long value = 0;
+
+        for(long i = 0; i < valueNumber; i++) {
+            forward.enqueue(i);
+            backward.dequeue(value);
+        }
+
+        echo.join();
+        Timer::keep(value);
+    }) * 1e6 / valueNumber;
+}
+
+
+
+
+int main() {
+    const long valueNumber = 2000000;
+    const long roundTripNumber = 20000;
+    const int capacity = 1024;
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+
+
+    {
+        LockedQueue queue, forward, backward;
+        const double streamTime = throughput(queue, valueNumber);
+
+        std::printf("Queue with a mutex: %6.1f ns per value, %8.0f ns per round trip\n", streamTime, roundTrip(forward, backward, roundTripNumber));
+    }
+
+    {
+        DSA::SPSCQueue<long> queue(capacity), forward(capacity), backward(capacity);
+        const double streamTime = throughput(queue, valueNumber);
+
+        std::printf("SPSCQueue:          %6.1f ns per value, %8.0f ns per round trip\n", streamTime, roundTrip(forward, backward, roundTripNumber));
+    }
+
+    {
+        DSA::MPMCQueue<long> queue(capacity), forward(capacity), backward(capacity);
+        const double streamTime = throughput(queue, valueNumber);
+
+        std::printf("MPMCQueue:          %6.1f ns per value, %8.0f ns per round trip\n", streamTime, roundTrip(forward, backward, roundTripNumber));
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+
+//runs the same loop on every thread and returns the time of a single iteration in nanoseconds
+template<typename Loop> double run(int threadNumber, int iterationNumber, Loop&& loop) {
+    const double milliseconds = Timer::milliseconds([&]() {
+        std::vector<std::thread> threads;
+
+        for(int thread = 0; thread < threadNumber; thread++) threads.emplace_back([&]() { loop(iterationNumber); });
+        for(std::thread& thread : threads) thread.join();
+    });
+
+    return milliseconds * 1e6 / (double(threadNumber) * iterationNumber);
+}
+
+
+
+
+int main() {
+    const int iterationNumber = 500000;
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+
+
+    for(int threadNumber : {1, 2, 4, 8}) {
+        std::mutex mutex;
+        DSA::Stack<int> locked;
+        DSA::ConcurrentStack<int> lockFree;
+
+        //every iteration pushes a value and pops one, taking the lock for each operation
+        const double lockedTime = run(threadNumber, iterationNumber, [&](int iterations) {
+            for(int i = 0; i < iterations; i++) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    locked.push(i);
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if(!locked.isEmpty()) locked.pop();
+            }
+        });
+
+        const double lockFreeTime = run(threadNumber, iterationNumber, [&](int iterations) {
+            for(int i = 0; i < iterations; i++) {
+                lockFree.push(i);
+                Timer::keep(lockFree.pop());
+            }
+        });
+
+
+        std::printf("%d threads: Stack with a mutex %6.1f ns per push and pop, ConcurrentStack %6.1f ns\n", threadNumber, lockedTime, lockFreeTime);
+    }
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+
+
+//looks up keys of which nine out of ten are missing, without and with the filter in front of the table
+template<template<typename> class Table> void run(const char* name, const std::vector<std::string>& keys, const std::vector<std::string>& lookups) {
+    for(bool filtered : {false, true}) {
+        DSA::HashMap<int, void, DSA::Hash<std::string>, Table> map;
+
+        for(int i = 0; i < int(keys.size()); i++) map.emplace(keys[i], i);
+
+        if(filtered) map.enableFilter();
+
+
+        int found = 0;
+
+        const double time = Timer::milliseconds([&]() {
+            for(const std::string& key : lookups) found += map.exist(key);
+        });
+
+        Timer::keep(found);
+
+
+        std::printf("%-13s %-15s %6.1f ns per lookup", name, filtered ? "with filter" : "without filter", time * 1e6 / double(lookups.size()));
+
+        if(filtered) {
+            const DSA::CountingBloomFilter& filter = *map.getFilter();
+            std::printf(", %.2f%% of the missing keys pass the filter", 100.0 * double(filter.getFalsePositives()) / double(filter.getNegatives() + filter.getFalsePositives()));
+        }
+
+        std::printf("\n");
+    }
+}
+
+
+
+
+int main() {
+    const int keyNumber = 1000000;
+    std::vector<std::string> keys;
+    std::vector<std::string> lookups;
+    std::mt19937 random(1);
+
+    for(int i = 0; i < keyNumber; i++) keys.push_back("key" + std::to_string(i));
+    for(int i = 0; i < 2 * keyNumber; i++) lookups.push_back((i % 10 == 0 ? "key" : "missing") + std::to_string(random() % keyNumber));
+
+
+    run<DSA::ChainedTable>("ChainedTable", keys, lookups);
+    run<DSA::FlatTable>("FlatTable", keys, lookups);
+
+    return 0;
+}
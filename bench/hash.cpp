@@ -0,0 +1,86 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+
+
+//the hash HashMap<T> used before Hash<std::string>, the sum of the characters of the key
+struct CharacterSum final {
+    std::uint64_t operator()(std::string_view key) const noexcept {
+        std::uint64_t sum = 0;
+
+        for(char character : key) sum += static_cast<unsigned char>(character);
+
+        return sum;
+    }
+};
+
+
+//spreads the keys over a fixed number of buckets and prints how many are used and the chain lengths
+template<typename Hasher> void distribution(const char* name, const std::vector<std::string>& keys) {
+    const int bucketNumber = 100;
+    std::vector<int> chains(bucketNumber, 0);
+    Hasher hasher;
+
+    for(const std::string& key : keys) chains[hasher(key) % bucketNumber]++;
+
+
+    const int used = int(std::count_if(chains.begin(), chains.end(), [](int length) { return length > 0; }));
+    int shortest = int(keys.size());
+    int longest = 0;
+
+    for(int length : chains) {
+        if(length > 0) shortest = std::min(shortest, length);
+        longest = std::max(longest, length);
+    }
+
+    std::printf("%-13s %3d of %d buckets used, chains from %d to %d keys\n", name, used, bucketNumber, shortest, longest);
+}
+
+//fills a HashMap with the hasher and times the lookups of every key
+template<typename Hasher> void lookups(const char* name, const std::vector<std::string>& keys) {
+    DSA::HashMap<int, void, Hasher> map;
+    const double insertion = Timer::milliseconds([&]() {
+        for(int i = 0; i < int(keys.size()); i++) map.emplace(keys[i], i);
+    });
+
+
+    long sum = 0;
+
+    const double lookup = Timer::milliseconds([&]() {
+        for(const std::string& key : keys) sum += *map.find(key);
+    });
+
+    Timer::keep(sum);
+
+
+    std::printf("%-13s %zu insertions: %8.2f ms, %zu lookups: %8.2f ms\n", name, keys.size(), insertion, keys.size(), lookup);
+}
+
+
+
+
+int main() {
+    std::vector<std::string> keys;
+    char buffer[16];
+
+    for(int i = 0; i < 100000; i++) {
+        std::snprintf(buffer, sizeof(buffer), "user%06d", i);
+        keys.emplace_back(buffer);
+    }
+
+
+    distribution<CharacterSum>("CharacterSum", keys);
+    distribution<DSA::Hash<std::string>>("Hash<string>", keys);
+
+    keys.resize(20000);
+
+    lookups<CharacterSum>("CharacterSum", keys);
+    lookups<DSA::Hash<std::string>>("Hash<string>", keys);
+
+    return 0;
+}
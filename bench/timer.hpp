@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+
+
+
+//minimal timing helpers shared by the benchmarks
+namespace Timer {
+    //runs the function once and returns the elapsed time in milliseconds
+    template<typename F> double milliseconds(F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    //keeps a result alive so that the compiler cannot drop the work producing it
+    template<typename T> void keep(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+}
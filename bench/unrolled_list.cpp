@@ -0,0 +1,44 @@
+#include "DSA.hpp"
+#include "timer.hpp"
+
+#include <random>
+
+
+
+
+//sequential iteration and random indexing over the same values
+template<typename L> void run(const char* name) {
+    const int length = 200000;
+    L list;
+
+    for(int i = 0; i < length; i++) list.pushBack(i);
+
+
+    long sum = 0;
+
+    const double sequential = Timer::milliseconds([&]() {
+        for(int pass = 0; pass < 50; pass++)
+            for(int value : list) sum += value;
+    });
+
+    std::mt19937 random(1);
+
+    const double indexed = Timer::milliseconds([&]() {
+        for(int i = 0; i < 2000; i++) sum += list[int(random() % length)];
+    });
+
+    Timer::keep(sum);
+
+
+    std::printf("%-14s 50 passes over %d values: %8.2f ms, 2000 random indexes: %8.2f ms\n", name, length, sequential, indexed);
+}
+
+
+
+
+int main() {
+    run<DSA::List<int>>("List");
+    run<DSA::UnrolledList<int>>("UnrolledList");
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+
+
+
+//minimal checking helpers shared by the tests, unlike assert they are not compiled away in release builds.
+//a failed check is printed and the test keeps running, so that main can return the result at the end
+namespace Check {
+    inline int failures = 0;
+
+
+    //prints the failed expression with its position
+    inline void report(bool passed, const char* expression, const char* file, int line) {
+        if(passed) return;
+
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        failures++;
+    }
+
+    //returns the exit code of the test
+    inline int result() {
+        if(failures > 0) std::fprintf(stderr, "%d checks failed\n", failures);
+
+        return (failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+
+
+
+#define CHECK(expression) Check::report(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+//the statement is variadic because template arguments contain commas
+#define CHECK_THROWS(...) \
+    do { \
+        bool thrown = false; \
+        try { __VA_ARGS__; } catch(...) { thrown = true; } \
+        Check::report(thrown, #__VA_ARGS__ " throws", __FILE__, __LINE__); \
+    } while(false)
@@ -0,0 +1,97 @@
+#include "DSA.hpp"
+#include "check.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+
+//several threads count on shared keys with compute() while adding and removing keys of their own,
+//at the end every counter has to hold the total number of increments
+template<template<typename> class Table> void sharedCounters() {
+    const int threadNumber = 8;
+    const int stepNumber = 20000;
+    const int counterNumber = 1000;
+
+    DSA::ConcurrentHashMap<int, long, DSA::Hash<int>, Table> map(8);
+    std::vector<std::thread> threads;
+
+
+    for(int thread = 0; thread < threadNumber; thread++) {
+        threads.emplace_back([&map, thread]() {
+            const int ownKeys = (thread + 1) * 100000;
+
+            for(int i = 0; i < stepNumber; i++) {
+                const int key = i % counterNumber;
+
+                map.compute(key, [](std::optional<long>& value) { value = value ? *value + 1 : 1; });
+
+                if(i % 7 == 0) map.insertOrAssign(ownKeys + i, long(i));
+                if(i % 7 == 0 && i >= 70) map.remove(ownKeys + i - 70);
+
+                (void)map.get(key);
+                (void)map.exist(key + 1);
+            }
+        });
+    }
+
+    for(std::thread& thread : threads) thread.join();
+
+
+    long total = 0;
+    bool counted = true;
+
+    for(int key = 0; key < counterNumber; key++) {
+        std::optional<long> value = map.get(key);
+
+        counted = counted && value;
+        total += value ? *value : 0;
+    }
+
+    CHECK(counted);
+    CHECK(total == long(threadNumber) * stepNumber);
+
+
+    //every thread keeps the last 10 of its own keys
+    CHECK(map.getLength() == counterNumber + threadNumber * 10);
+
+    const int removed = map.eraseIf([](const int& key, long&) { return key >= 100000; });
+
+    CHECK(removed == threadNumber * 10);
+    CHECK(map.getLength() == counterNumber);
+}
+
+//the single threaded semantics of the operations
+void operations() {
+    DSA::ConcurrentHashMap<int, long> map;
+
+    CHECK(map.tryEmplace(5, 3L));
+    CHECK(!map.tryEmplace(5, 4L));
+    CHECK(*map.get(5) == 3);
+
+    CHECK(!map.compute(5, [](std::optional<long>& value) { value.reset(); }));
+    CHECK(!map.exist(5));
+    CHECK(!map.get(5));
+    CHECK(!map.remove(5));
+
+
+    DSA::ConcurrentHashMap<std::string> strings;
+
+    CHECK(strings.insertOrAssign("a", std::string("b")));
+    CHECK(!strings.insertOrAssign("a", std::string("c")));
+    CHECK(*strings.get("a") == "c");
+    CHECK(strings.exist(std::string_view("a")));
+}
+
+
+
+
+int main() {
+    sharedCounters<DSA::ChainedTable>();
+    sharedCounters<DSA::FlatTable>();
+    operations();
+
+    return Check::result();
+}
@@ -0,0 +1,131 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+
+//a producer and a consumer share a small ring, the consumer has to see every value in order
+void singleProducer() {
+    const int valueNumber = 200000;
+    DSA::SPSCQueue<std::string> queue(64);
+    bool ordered = true;
+
+
+    std::thread consumer([&queue, &ordered]() {
+        std::string value;
+
+        for(int i = 0; i < valueNumber; i++) {
+            queue.dequeue(value);
+            ordered = ordered && value == std::to_string(i);
+        }
+    });
+
+    for(int i = 0; i < valueNumber; i++) queue.enqueue(std::to_string(i));
+
+    consumer.join();
+
+
+    CHECK(ordered);
+    CHECK(queue.isEmpty() && queue.getLength() == 0);
+}
+
+//4 producers and 4 consumers: every value is dequeued once, and the values of a producer reach each consumer in order
+void multipleProducers() {
+    const int threadNumber = 4;
+    const long valueNumber = 50000;
+
+    DSA::MPMCQueue<long> queue(64);
+    Fixtures::Counts seen(std::size_t(threadNumber) * valueNumber);
+    std::atomic<bool> ordered(true);
+    std::vector<std::thread> threads;
+
+
+    for(int producer = 0; producer < threadNumber; producer++) {
+        threads.emplace_back([&queue, producer]() {
+            for(long i = 0; i < valueNumber; i++) queue.enqueue(producer * valueNumber + i);
+        });
+    }
+
+    for(int consumer = 0; consumer < threadNumber; consumer++) {
+        threads.emplace_back([&]() {
+            std::vector<long> last(threadNumber, -1);
+            long value;
+
+            for(long i = 0; i < valueNumber; i++) {
+                queue.dequeue(value);
+                seen.add(value);
+
+                if(value <= last[value / valueNumber]) ordered = false;
+
+                last[value / valueNumber] = value;
+            }
+        });
+    }
+
+    for(std::thread& thread : threads) thread.join();
+
+
+    CHECK(seen.eachOnce());
+    CHECK(ordered);
+    CHECK(queue.isEmpty());
+}
+
+//the single threaded semantics of the try operations on full and empty queues
+void operations() {
+    CHECK_THROWS(DSA::SPSCQueue<int>(0));
+    CHECK_THROWS(DSA::SPSCQueue<int>(-1));
+    CHECK_THROWS(DSA::MPMCQueue<int>(-1));
+    CHECK(DSA::SPSCQueue<int>(1).getCapacity() == 2);
+    CHECK(DSA::MPMCQueue<int>(1).getCapacity() == 2);
+
+
+    DSA::SPSCQueue<std::string> single(3);
+    std::string value;
+
+    CHECK(single.getCapacity() == 4);
+    CHECK(!single.tryDequeue(value));
+    CHECK_THROWS(single.head());
+
+    for(int i = 0; i < 4; i++) CHECK(single.tryEnqueue(std::to_string(i)));
+
+    CHECK(!single.tryEnqueue("full"));
+    CHECK(single.head() == "0");
+    CHECK(single.tryDequeue(value) && value == "0");
+    CHECK(single.getLength() == 3);
+
+
+    DSA::MPMCQueue<std::string> multiple(2);
+    std::string kept = "kept";
+    std::string rejected = "rejected";
+
+    CHECK(multiple.tryEmplace(3, 'a'));
+    CHECK(multiple.tryEnqueue(std::move(kept)));
+
+    //a failed try leaves the argument untouched
+    CHECK(!multiple.tryEnqueue(std::move(rejected)) && rejected == "rejected");
+    CHECK(multiple.tryDequeue(value) && value == "aaa");
+    CHECK(multiple.tryDequeue(value) && value == "kept");
+    CHECK(!multiple.tryDequeue(value));
+
+
+    //the values left in the queues are destroyed with them
+    multiple.enqueue("left");
+    single.enqueue("left");
+}
+
+
+
+
+int main() {
+    operations();
+    singleProducer();
+    multipleProducers();
+
+    return Check::result();
+}
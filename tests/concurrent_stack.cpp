@@ -0,0 +1,129 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+
+//a number whose copies throw now and then, moves never throw
+struct Unreliable {
+    inline static std::atomic<unsigned> copies = 0;
+    long value;
+
+    explicit Unreliable(long value) : value(value) {}
+    Unreliable(const Unreliable& other) : value(other.value) {
+        if(copies.fetch_add(1, std::memory_order_relaxed) % 7 == 3) throw std::runtime_error("copy");
+    }
+    Unreliable(Unreliable&&) noexcept = default;
+};
+
+
+//every thread pushes its own values and pops about half as many, then the rest is popped:
+//each value has to come out exactly once
+void pushPop(int threadNumber, int valueNumber) {
+    DSA::ConcurrentStack<long> stack;
+    Fixtures::Counts seen(std::size_t(threadNumber) * valueNumber);
+    std::vector<std::thread> threads;
+
+
+    for(int thread = 0; thread < threadNumber; thread++) {
+        threads.emplace_back([&stack, &seen, thread, valueNumber]() {
+            for(int i = 0; i < valueNumber; i++) {
+                stack.push(long(thread) * valueNumber + i);
+
+                if(i % 2 == 1) {
+                    if(std::optional<long> value = stack.pop()) seen.add(*value);
+                }
+
+                (void)stack.top();
+            }
+        });
+    }
+
+    for(std::thread& thread : threads) thread.join();
+
+    while(std::optional<long> value = stack.pop()) seen.add(*value);
+
+
+    CHECK(seen.eachOnce());
+    CHECK(stack.isEmpty());
+}
+
+//the pops whose copy throws leave the element in the stack and are retried, while other threads push and
+//pop the same head: each value still has to come out exactly once
+void throwingPops(int threadNumber, int valueNumber) {
+    DSA::ConcurrentStack<Unreliable> stack;
+    Fixtures::Counts seen(std::size_t(threadNumber) * valueNumber);
+    std::vector<std::thread> threads;
+
+
+    //pops until a copy succeeds, returns false if the stack was empty
+    auto popOnce = [&stack, &seen]() {
+        while(true) {
+            try {
+                std::optional<Unreliable> popped = stack.pop();
+
+                if(popped) seen.add(popped->value);
+
+                return bool(popped);
+            }
+            catch(const std::runtime_error&) {}
+        }
+    };
+
+    for(int thread = 0; thread < threadNumber; thread++) {
+        threads.emplace_back([&stack, &popOnce, thread, valueNumber]() {
+            for(int i = 0; i < valueNumber; i++) {
+                stack.push(Unreliable(long(thread) * valueNumber + i));
+
+                if(i % 2 == 1) popOnce();
+            }
+        });
+    }
+
+    for(std::thread& thread : threads) thread.join();
+
+    while(popOnce()) {}
+
+
+    CHECK(seen.eachOnce());
+    CHECK(stack.isEmpty());
+}
+
+//the single threaded semantics of the operations, the nodes left in the stack are freed by the destructor
+void operations() {
+    DSA::ConcurrentStack<std::string> stack;
+
+    CHECK(stack.isEmpty() && !stack.pop() && !stack.top());
+
+    stack.push("a");
+    stack.emplace(3, 'b');
+
+    CHECK(*stack.top() == "bbb");
+    CHECK(*stack.pop() == "bbb");
+    CHECK(*stack.pop() == "a");
+    CHECK(stack.isEmpty());
+
+    stack.push("left in the stack");
+}
+
+
+
+
+int main() {
+    operations();
+    pushPop(8, 20000);
+
+    //many more threads than a fixed table of hazard pointers would hold
+    pushPop(300, 500);
+
+    throwingPops(8, 20000);
+
+    return Check::result();
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+
+
+//fixtures shared by the tests: the values stored in the containers, the helpers that run the same random operations
+//on a container and on a std:: reference and compare them, and the types that check the exceptional paths
+namespace Fixtures {
+    //the value of a step as a number
+    inline int number(int step) {
+        return step;
+    }
+
+    //the value of a step as a string too long for the small string buffer, so that it lives on the heap
+    inline std::string longString(int step) {
+        return std::to_string(step) + " is longer than the small string buffer";
+    }
+
+
+    //calls operation with the random generator and the number of every step, and compare every interval steps
+    //and after the last one
+    template<typename Operation, typename Compare> void randomSteps(unsigned seed, int stepNumber, int interval, Operation&& operation, Compare&& compare) {
+        std::mt19937 random(seed);
+
+        for(int step = 0; step < stepNumber; step++) {
+            operation(random, step);
+
+            if(step % interval == 0) compare();
+        }
+
+        compare();
+    }
+
+    //checks that the container holds length values equal to the ones between first and last, in the same order.
+    //forEach receives the function to call with every value of the container
+    template<typename Iterator, typename ForEach> bool sameValues(int length, Iterator first, Iterator last, ForEach&& forEach) {
+        if(length != int(std::distance(first, last))) return false;
+
+
+        bool matches = true;
+
+        forEach([&matches, &first, &last](const auto& value) {
+            matches = matches && first != last && value == *first;
+
+            if(first != last) ++first;
+        });
+
+        return matches && first == last;
+    }
+
+
+    //a string whose copies and move assignments throw once their budget runs out, a negative budget never runs out
+    struct Fragile {
+        inline static int copies = -1;
+        inline static int assignments = -1;
+        std::string value;
+
+        Fragile(std::string value) : value(std::move(value)) {}
+        Fragile(const Fragile& other) : value(other.value) {
+            spend(copies);
+        }
+        Fragile(Fragile&&) noexcept = default;
+        Fragile& operator=(const Fragile&) = default;
+        Fragile& operator=(Fragile&& other) {
+            spend(assignments);
+            value = std::move(other.value);
+
+            return *this;
+        }
+
+        static void spend(int& budget) {
+            if(budget == 0) throw std::runtime_error("budget");
+            if(budget > 0) budget--;
+        }
+
+        bool operator==(const Fragile& other) const { return value == other.value; }
+    };
+
+    //counts how many times the threads of a concurrent test see every value
+    class Counts {
+        private:
+            std::vector<std::atomic<int>> counts;
+
+
+        public:
+            explicit Counts(std::size_t valueNumber) : counts(valueNumber) {
+                for(std::atomic<int>& count : counts) count.store(0, std::memory_order_relaxed);
+            }
+
+            void add(std::size_t value) noexcept {
+                counts[value].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            //returns true if every value has been seen exactly once
+            bool eachOnce() const noexcept {
+                for(const std::atomic<int>& count : counts)
+                    if(count.load() != 1) return false;
+
+                return true;
+            }
+    };
+}
@@ -0,0 +1,100 @@
+#include "DSA.hpp"
+#include "check.hpp"
+
+#include <random>
+#include <string>
+
+
+
+
+//hasher that gives every key the same hash, no perfect hash can separate two keys with it
+struct ConstantHash final {
+    std::uint64_t operator()(long) const noexcept {
+        return 7;
+    }
+};
+
+
+//every pair of the map has to be found in the frozen map with the same value
+template<typename Map, typename Frozen> bool equals(Map& map, Frozen& frozen) {
+    bool matches = frozen.getLength() == map.getLength();
+
+    map.forEach([&](const auto& key, auto& value) {
+        const auto* found = frozen.find(key);
+
+        matches = matches && found && *found == value && frozen.exist(key);
+    });
+
+    return matches;
+}
+
+//freezes maps of many sizes, including the empty map and a single pair
+void sizes() {
+    for(int length : {0, 1, 2, 3, 5, 17, 100, 1000, 100000}) {
+        DSA::HashMap<int> map;
+
+        for(int i = 0; i < length; i++) map.emplace("key" + std::to_string(i * 3), i);
+
+        auto frozen = map.freeze();
+        bool missing = true;
+
+        for(int i = 0; i < length * 3 + 10; i++)
+            if(i % 3 != 0) missing = missing && !frozen.exist("key" + std::to_string(i));
+
+        CHECK(equals(map, frozen));
+        CHECK(missing);
+    }
+}
+
+//random integer keys in a FlatTable, the values of the frozen map can still be modified
+void modifiableValues() {
+    DSA::HashMap<long, std::string, DSA::Hash<long>, DSA::FlatTable> map;
+    std::mt19937_64 random(1);
+
+    for(int i = 0; i < 5000; i++) map.insertOrAssign(long(random()), std::to_string(i));
+
+    auto frozen = map.freeze();
+
+    CHECK(equals(map, frozen));
+
+
+    frozen.forEach([](const long&, std::string& value) { value += "!"; });
+
+    int visited = 0;
+    bool modified = true;
+
+    frozen.forEach([&](const long&, std::string& value) {
+        visited++;
+        modified = modified && value.back() == '!';
+    });
+
+    CHECK(visited == map.getLength() && modified);
+    CHECK_THROWS(frozen[-1]);
+}
+
+//a hasher that can't separate the keys makes the construction throw instead of looping forever
+void constantHash() {
+    DSA::HashMap<long, int, ConstantHash> map;
+
+    map.emplace(1, 1);
+
+    auto single = map.freeze();
+
+    CHECK(single[1] == 1 && !single.exist(2));
+
+
+    map.emplace(2, 2);
+
+    CHECK_THROWS(map.freeze());
+}
+
+
+
+
+int main() {
+    sizes();
+    modifiableValues();
+    constantHash();
+
+    return Check::result();
+}
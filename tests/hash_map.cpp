@@ -0,0 +1,232 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+
+//hasher that sends the keys to only 64 hash values, so that every lookup walks a long chain or probe sequence
+//and the FlatTable fills its groups with slots of the same control byte
+struct CollidingHash final {
+    std::uint64_t operator()(int key) const noexcept {
+        return std::uint64_t(key & 63) * 0x9E3779B97F4A7C15ull;
+    }
+};
+
+
+//compares the map with the reference, the iteration has to follow the insertion order
+template<typename Map> bool equals(Map& map, const std::unordered_map<int, int>& reference, const std::vector<int>& order) {
+    std::vector<std::pair<int, int>> pairs;
+
+    for(int key : order) pairs.emplace_back(key, reference.at(key));
+
+
+    for(const auto& [key, value] : pairs) {
+        const int* found = map.find(key);
+
+        if(!found || *found != value) return false;
+    }
+
+    return Fixtures::sameValues(map.getLength(), pairs.begin(), pairs.end(), [&map](auto&& visit) {
+        for(auto [key, value] : map) visit(std::pair<int, int>(key, value));
+    });
+}
+
+//applies the same random operations to the map and to a std::unordered_map, the map grows and shrinks
+//many times so that the lookups also run while the table is moving to a larger one
+template<typename Hasher, template<typename> class Table> void randomOperations(unsigned seed) {
+    DSA::HashMap<int, int, Hasher, Table> map;
+    std::unordered_map<int, int> reference;
+    std::vector<int> order;
+
+
+    Fixtures::randomSteps(seed, 30000, 1009, [&](std::mt19937& random, int step) {
+        const int key = int(random() % 3000);
+        const bool present = reference.count(key) > 0;
+
+        switch(random() % 6) {
+            case 0:
+                if(present) {
+                    CHECK_THROWS(map.emplace(key, step));
+                }
+                else {
+                    map.emplace(key, step);
+                    reference[key] = step;
+                    order.push_back(key);
+                }
+                break;
+
+            case 1: {
+                auto [value, added] = map.tryEmplace(key, step);
+
+                CHECK(added == !present);
+                if(!present) {
+                    reference[key] = step;
+                    order.push_back(key);
+                }
+
+                CHECK(*value == reference[key]);
+                break;
+            }
+
+            case 2: {
+                auto [value, added] = map.insertOrAssign(key, step);
+
+                CHECK(added == !present && *value == step);
+                if(!present) order.push_back(key);
+
+                reference[key] = step;
+                break;
+            }
+
+            case 3:
+            case 4:
+                CHECK(map.erase(key) == present);
+
+                if(present) {
+                    reference.erase(key);
+                    order.erase(std::find(order.begin(), order.end(), key));
+                }
+                break;
+
+            case 5:
+                CHECK(map.exist(key) == present);
+
+                if(present) CHECK(map[key] == reference[key]);
+                else CHECK_THROWS(map[key]);
+                break;
+        }
+
+    }, [&]() {
+        CHECK(equals(map, reference, order));
+    });
+
+
+    //a long run of insertions and removals makes the array compact and the table grow several times
+    for(int key = 3000; key < 40000; key++) {
+        map.emplace(key, key);
+        reference[key] = key;
+        order.push_back(key);
+
+        CHECK(map.exist(key - 1500 + (key & 1)) == (reference.count(key - 1500 + (key & 1)) > 0));
+    }
+
+    for(int key = 3000; key < 40000; key += 2) {
+        map.remove(key);
+        reference.erase(key);
+    }
+
+    order.erase(std::remove_if(order.begin(), order.end(), [](int key) { return key >= 3000 && key % 2 == 0; }), order.end());
+
+    CHECK(equals(map, reference, order));
+    CHECK_THROWS(map.remove(3000));
+
+    const int bucketNumber = map.getBucketNumber();
+    CHECK(bucketNumber > 0 && (bucketNumber & (bucketNumber - 1)) == 0);
+    CHECK(map.getLoadFactor() <= 1);
+}
+
+//the original HashMap<T> with std::string keys, looked up through std::string_view and const char*
+template<template<typename> class Table> void stringKeys() {
+    DSA::HashMap<int, void, DSA::Hash<std::string>, Table> map;
+
+    for(int i = 0; i < 1000; i++) map.add(DSA::Pair<int>("key" + std::to_string(i), i));
+
+    CHECK(map.getLength() == 1000);
+    CHECK(map["key500"] == 500);
+    CHECK(map.exist(std::string_view("key999")));
+    CHECK(!map.exist("key1000"));
+    CHECK_THROWS(map.add(DSA::Pair<int>("key1", 0)));
+
+
+    map.reserve(5000);
+    const int bucketNumber = map.getBucketNumber();
+
+    for(int i = 1000; i < 4000; i++) map.emplace("key" + std::to_string(i), i);
+
+    CHECK(map.getBucketNumber() == bucketNumber);
+    CHECK(map.getKeys().size() == 4000 && map.getKeys()[1234] == "key1234");
+}
+
+
+//batched lookups from an array of std::string_view, they must not touch the statistics of the filter
+template<template<typename> class Table> void batchedLookups() {
+    DSA::HashMap<int, void, DSA::Hash<std::string>, Table> map;
+    std::vector<std::string> names;
+
+    for(int i = 0; i < 200; i++) names.push_back("key" + std::to_string(i));
+    for(int i = 0; i < 200; i += 2) map.emplace(names[i], i);
+
+    map.enableFilter();
+
+
+    std::vector<std::string_view> keys(names.begin(), names.end());
+    std::vector<int*> values(keys.size());
+    std::vector<std::uint64_t> misses((keys.size() + 63) / 64);
+    const std::uint64_t lookups = map.getFilter()->getLookups();
+
+    CHECK(map.getMany(keys.data(), keys.size(), values.data(), misses.data()) == 100);
+    CHECK(map.existMany(names.data(), names.size(), misses.data()) == 100);
+    CHECK(map.getFilter()->getLookups() == lookups);
+
+
+    bool matches = true;
+
+    for(std::size_t i = 0; i < keys.size(); i++) {
+        const bool missing = (misses[i / 64] >> (i % 64)) & 1;
+
+        matches = matches && missing == (i % 2 == 1);
+        matches = matches && (missing ? values[i] == nullptr : values[i] && *values[i] == int(i));
+    }
+
+    CHECK(matches);
+}
+
+
+//the insertions must not count as lookups in the statistics of the filter, only the lookups of the user do
+template<template<typename> class Table> void filterStatistics() {
+    DSA::HashMap<std::string, int, DSA::Hash<std::string>, Table> map;
+
+    map.enableFilter();
+
+    for(int i = 0; i < 1000; i++) map.emplace("key" + std::to_string(i), i);
+    for(int i = 0; i < 1000; i++) map.tryEmplace("key" + std::to_string(i), -i);
+    for(int i = 1000; i < 2000; i++) map.insertOrAssign("key" + std::to_string(i), i);
+
+    CHECK(map.getLength() == 2000);
+    CHECK(map.getFilter()->getLookups() == 0 && map.getFilter()->getFalsePositives() == 0);
+
+
+    for(int i = 0; i < 4000; i++) map.exist("key" + std::to_string(i));
+
+    const DSA::CountingBloomFilter& filter = *map.getFilter();
+
+    CHECK(filter.getLookups() == 4000);
+    CHECK(filter.getNegatives() + filter.getFalsePositives() == 2000);
+}
+
+
+
+
+int main() {
+    randomOperations<DSA::Hash<int>, DSA::ChainedTable>(1);
+    randomOperations<CollidingHash, DSA::ChainedTable>(2);
+    stringKeys<DSA::ChainedTable>();
+
+    randomOperations<DSA::Hash<int>, DSA::FlatTable>(3);
+    randomOperations<CollidingHash, DSA::FlatTable>(4);
+    stringKeys<DSA::FlatTable>();
+
+    batchedLookups<DSA::ChainedTable>();
+    batchedLookups<DSA::FlatTable>();
+
+    filterStatistics<DSA::ChainedTable>();
+    filterStatistics<DSA::FlatTable>();
+
+    return Check::result();
+}
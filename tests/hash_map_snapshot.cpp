@@ -0,0 +1,159 @@
+#include "DSA.hpp"
+#include "check.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+
+
+
+//saves a map with removed pairs, opens the snapshot and promotes it back, every step is compared with the reference
+void integerKeys(const std::string& path) {
+    DSA::HashMap<int, double> map;
+    std::unordered_map<int, double> reference;
+
+    for(int key = 0; key < 20000; key++) {
+        map.emplace(key * 7, key * 0.5);
+        reference[key * 7] = key * 0.5;
+    }
+
+    for(int key = 0; key < 20000; key += 3) {
+        map.remove(key * 7);
+        reference.erase(key * 7);
+    }
+
+    map.saveSnapshot(path);
+
+
+    auto snapshot = DSA::HashMap<int, double>::openSnapshot(path);
+    bool matches = snapshot.getLength() == int(reference.size()) && snapshot.verify();
+
+    for(const auto& [key, value] : reference) {
+        const double* found = snapshot.find(key);
+
+        matches = matches && found && *found == value;
+    }
+
+    CHECK(matches);
+    CHECK(!snapshot.exist(1));
+    CHECK_THROWS(snapshot[1]);
+
+
+    DSA::HashMap<int, double> promoted(snapshot);
+    int index = 0;
+
+    matches = promoted.getLength() == int(reference.size());
+
+    for(auto [key, value] : map) {
+        matches = matches && promoted.getKeys()[index] == key && promoted[key] == value;
+        index++;
+
+        if(index == 100) break;
+    }
+
+    for(const auto& [key, value] : reference) matches = matches && promoted.exist(key) && promoted[key] == value;
+
+    CHECK(matches);
+}
+
+//std::string keys are stored in a separate section of the file and looked up through std::string_view
+void stringKeys(const std::string& path) {
+    DSA::HashMap<int> map;
+
+    for(int i = 0; i < 1000; i++) map.emplace("key" + std::to_string(i), i);
+
+    map.saveSnapshot(path);
+
+
+    auto snapshot = DSA::HashMap<int>::openSnapshot(path);
+
+    CHECK(snapshot.getLength() == 1000);
+    CHECK(snapshot["key999"] == 999);
+    CHECK(snapshot.getKey(10) == "key10" && snapshot.getValue(10) == 10);
+    CHECK(!snapshot.exist(std::string_view("key1000")));
+
+
+    DSA::HashMap<int> empty;
+    empty.saveSnapshot(path);
+
+    CHECK(DSA::HashMap<int>::openSnapshot(path).getLength() == 0);
+    CHECK(DSA::HashMap<int>(DSA::HashMap<int>::openSnapshot(path)).getLength() == 0);
+}
+
+//a slot whose index repeats the one of another slot must be rejected when the snapshot is promoted
+void damagedIndexes(const std::string& path) {
+    DSA::HashMap<int, int> map;
+
+    for(int key = 0; key < 100; key++) map.emplace(key, key);
+
+    map.saveSnapshot(path);
+
+
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    std::uint64_t slotsOffset = 0;
+    std::uint64_t index = 0;
+
+    //the offset of the slots follows the magic, four 32 bit fields and three 64 bit fields of the header,
+    //every slot is a hash value followed by an index
+    file.seekg(48);
+    file.read(reinterpret_cast<char*>(&slotsOffset), sizeof(slotsOffset));
+    file.seekg(std::streamoff(slotsOffset + 8));
+    file.read(reinterpret_cast<char*>(&index), sizeof(index));
+    file.seekp(std::streamoff(slotsOffset + 16 + 8));
+    file.write(reinterpret_cast<const char*>(&index), sizeof(index));
+    file.close();
+
+
+    auto snapshot = DSA::HashMap<int, int>::openSnapshot(path);
+
+    CHECK(!snapshot.verify());
+    CHECK_THROWS(DSA::HashMap<int, int>{snapshot});
+    CHECK_THROWS(DSA::HashMap<int, int>::openSnapshot(path + ".missing"));
+}
+
+
+//a key whose offsets point outside of the file must be rejected when the snapshot is promoted
+void damagedKeys(const std::string& path) {
+    DSA::HashMap<int> map;
+
+    for(int i = 0; i < 100; i++) map.emplace("key" + std::to_string(i), i);
+
+    map.saveSnapshot(path);
+
+
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    std::uint64_t keysOffset = 0;
+    const std::uint64_t outside = std::uint64_t(1) << 40;
+
+    //the offset of the key offsets follows the one of the slots, the end of the first key is the start of the second one
+    file.seekg(56);
+    file.read(reinterpret_cast<char*>(&keysOffset), sizeof(keysOffset));
+    file.seekp(std::streamoff(keysOffset + 8));
+    file.write(reinterpret_cast<const char*>(&outside), sizeof(outside));
+    file.close();
+
+
+    auto snapshot = DSA::HashMap<int>::openSnapshot(path);
+
+    CHECK(!snapshot.verify());
+    CHECK(snapshot.getKey(0).empty() && snapshot.getKey(1).empty());
+    CHECK_THROWS(DSA::HashMap<int>{snapshot});
+}
+
+
+
+
+int main() {
+    const std::string path = "hash_map_snapshot.test";
+
+    integerKeys(path);
+    stringKeys(path);
+    damagedIndexes(path);
+    damagedKeys(path);
+
+    std::remove(path.c_str());
+
+    return Check::result();
+}
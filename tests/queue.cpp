@@ -0,0 +1,150 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <deque>
+#include <string>
+
+
+
+
+//compares the elements of the queue with the reference by dequeuing a copy
+template<typename T> bool equals(const DSA::Queue<T>& queue, const std::deque<T>& reference) {
+    return Fixtures::sameValues(queue.getLength(), reference.begin(), reference.end(), [&queue](auto&& visit) {
+        DSA::Queue<T> copy(queue);
+
+        for(; !copy.isEmpty(); copy.dequeue()) visit(copy.head());
+    });
+}
+
+//applies the same random operations to the queue and to a std::deque, the head moves around the ring
+//and the buffer grows while the elements wrap around its end
+template<typename T, typename Make> void randomOperations(unsigned seed, Make make) {
+    DSA::Queue<T> queue;
+    std::deque<T> reference;
+
+
+    Fixtures::randomSteps(seed, 30000, 1013, [&](std::mt19937& random, int step) {
+        const unsigned operation = random() % 10;
+
+        if(operation < 5 || reference.empty()) {
+            queue.enqueue(make(step));
+            reference.push_back(make(step));
+        }
+        else if(operation < 9) {
+            CHECK(queue.head() == reference.front());
+
+            queue.dequeue();
+            reference.pop_front();
+        }
+        else {
+            //enqueuing the head must copy it before the buffer grows
+            queue.enqueue(queue.head());
+            reference.push_back(reference.front());
+        }
+    }, [&]() {
+        CHECK(equals(queue, reference));
+    });
+
+    const int capacity = queue.getCapacity();
+    CHECK(capacity >= queue.getLength() && (capacity & (capacity - 1)) == 0);
+}
+
+//copies, moves and the checks on an empty queue
+void ownership() {
+    DSA::Queue<std::string> queue;
+
+    CHECK_THROWS(queue.head());
+
+    queue.dequeue();
+
+    for(int i = 0; i < 100; i++) queue.emplace(std::to_string(i));
+
+
+    DSA::Queue<std::string> copy(queue);
+    DSA::Queue<std::string> moved(std::move(queue));
+
+    CHECK(queue.isEmpty());
+    CHECK(copy.getLength() == 100 && moved.head() == "0");
+
+    queue = moved;
+    moved = std::move(copy);
+
+    CHECK(queue.getLength() == 100 && moved.getLength() == 100 && queue.head() == moved.head());
+
+    queue.clear();
+
+    CHECK(queue.isEmpty());
+
+
+    DSA::Queue<int> numbers;
+
+    for(int i = 1; i <= 3; i++) numbers.enqueue(i);
+
+    CHECK(numbers.toString() == "[3, 2, 1]");
+    CHECK(numbers.toString(DSA::Modality::Verse::backwards) == "[1, 2, 3]");
+}
+
+//enqueues and dequeues in batches across the end of the ring, also from the elements of the queue itself
+//and with copies that throw
+void bulkOperations() {
+    DSA::Queue<std::string> queue;
+    std::deque<std::string> reference;
+    std::string values[20];
+
+    for(int i = 0; i < 20; i++) values[i] = Fixtures::longString(i);
+
+    for(int round = 0; round < 50; round++) {
+        queue.enqueueBulk(values, 7 + round % 13);
+        reference.insert(reference.end(), values, values + 7 + round % 13);
+
+        std::string dequeued[20];
+        const int count = queue.dequeueBulk(dequeued, 5 + round % 11);
+
+        for(int i = 0; i < count; i++) {
+            CHECK(dequeued[i] == reference.front());
+            reference.pop_front();
+        }
+
+        CHECK(equals(queue, reference));
+    }
+
+
+    //the queue is full and starts at the beginning of the buffer, its elements are enqueued again while it grows
+    DSA::Queue<int> numbers;
+
+    for(int i = 0; i < 16; i++) numbers.enqueue(i % 8);
+
+    const int capacity = numbers.getCapacity();
+
+    numbers.enqueueBulk(&numbers.head(), numbers.getLength());
+
+    CHECK(numbers.getCapacity() > capacity);
+    CHECK(equals(numbers, std::deque<int>{0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7}));
+
+
+    //a copy throwing in the middle of the batch leaves the queue as it was
+    DSA::Queue<Fixtures::Fragile> fragile;
+    std::vector<Fixtures::Fragile> batch(5, Fixtures::Fragile("fragile"));
+
+    fragile.enqueue(Fixtures::Fragile("first"));
+
+    Fixtures::Fragile::copies = 3;
+    CHECK_THROWS(fragile.enqueueBulk(batch.data(), 5));
+    Fixtures::Fragile::copies = -1;
+
+    CHECK(equals(fragile, std::deque<Fixtures::Fragile>{Fixtures::Fragile("first")}));
+}
+
+
+
+
+int main() {
+    randomOperations<int>(1, Fixtures::number);
+    randomOperations<std::string>(2, Fixtures::longString);
+
+    ownership();
+    bulkOperations();
+
+    return Check::result();
+}
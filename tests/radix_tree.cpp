@@ -0,0 +1,183 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <string>
+
+
+
+
+//the global allocation functions count the live blocks and can be told to fail, so that the test can check
+//that a failed insertion leaves neither changes nor leaked nodes behind
+namespace Allocations {
+    int live = 0;
+    int failAfter = -1;
+}
+
+void* operator new(std::size_t size) {
+    if(Allocations::failAfter == 0) throw std::bad_alloc();
+    if(Allocations::failAfter > 0) Allocations::failAfter--;
+
+
+    void* block = std::malloc(size ? size : 1);
+
+    if(!block) throw std::bad_alloc();
+
+    Allocations::live++;
+    return block;
+}
+
+void operator delete(void* block) noexcept {
+    if(!block) return;
+
+    Allocations::live--;
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    operator delete(block);
+}
+
+
+
+
+//compares the pairs of the tree with the reference, the keys have to be visited in order
+bool equals(DSA::RadixTree<int>& tree, const std::map<std::string, int>& reference) {
+    return Fixtures::sameValues(tree.getLength(), reference.begin(), reference.end(), [&tree](auto&& visit) {
+        tree.forEach([&visit](const std::string& key, int& value) { visit(std::pair<const std::string, int>(key, value)); });
+    });
+}
+
+//random keys over a small alphabet share long prefixes, so the insertions split nodes and the removals merge them
+void randomOperations() {
+    DSA::RadixTree<int> tree;
+    std::map<std::string, int> reference;
+
+
+    Fixtures::randomSteps(1, 20000, 997, [&](std::mt19937& random, int step) {
+        std::string key(random() % 8, 'a');
+
+        for(char& character : key) character = char('a' + random() % 3);
+
+        const bool present = reference.count(key) > 0;
+
+        switch(random() % 4) {
+            case 0:
+            case 1:
+                if(present) {
+                    CHECK_THROWS(tree.emplace(key, step));
+                }
+                else {
+                    tree.emplace(key, step);
+                    reference[key] = step;
+                }
+                break;
+
+            case 2:
+                CHECK(tree.erase(key) == present);
+                reference.erase(key);
+                break;
+
+            case 3:
+                CHECK(tree.exist(key) == present);
+                CHECK(present ? tree.find(key) && *tree.find(key) == reference[key] : tree.find(key) == nullptr);
+                break;
+        }
+    }, [&]() {
+        CHECK(equals(tree, reference));
+    });
+
+
+    //the pairs below a prefix are the range of the reference that starts with it
+    for(const char* prefix : {"", "a", "ab", "cab", "bbbbbbb", "z"}) {
+        int expected = 0;
+
+        for(auto pair = reference.lower_bound(prefix); pair != reference.end() && pair->first.compare(0, std::strlen(prefix), prefix) == 0; ++pair) expected++;
+
+        CHECK(tree.prefixScan(prefix, [](const std::string&, int&) {}) == expected);
+    }
+}
+
+//a node gets a child for every byte and shrinks back as they are removed
+void nodeSizes() {
+    DSA::RadixTree<int> tree;
+
+    for(int byte = 0; byte < 256; byte++) tree.emplace(std::string("x") + char(byte), byte);
+
+    CHECK(tree.getLength() == 256);
+    CHECK(tree[std::string("x") + char(200)] == 200);
+
+    for(int byte = 255; byte >= 2; byte--) tree.remove(std::string("x") + char(byte));
+
+    CHECK(tree.getKeys() == std::vector<std::string>({std::string("x") + char(0), std::string("x") + char(1)}));
+
+
+    tree.emplace("http", 1);
+    tree.emplace("http://example", 2);
+
+    std::size_t matchLength = 0;
+
+    CHECK(*tree.longestPrefixMatch("http://example/index", &matchLength) == 2 && matchLength == 14);
+    CHECK(*tree.longestPrefixMatch("https", &matchLength) == 1 && matchLength == 4);
+    CHECK(tree.longestPrefixMatch("htt") == nullptr);
+}
+
+//makes every allocation of an insertion fail in turn: the tree must keep its pairs and its nodes
+void failedInsertions() {
+    DSA::RadixTree<int> tree;
+    std::map<std::string, int> reference;
+
+    for(const char* key : {"romane", "romanus", "romulus", "rubens", "ruber", "rubicon", "rubicundus"}) {
+        tree.emplace(key, int(reference.size()));
+        reference[key] = int(reference.size());
+    }
+
+
+    for(const char* key : {"rom", "romanes", "rubrum", "s", "rubiconia"}) {
+        bool inserted = false;
+
+        for(int allocation = 0; !inserted; allocation++) {
+            const int live = Allocations::live;
+
+            Allocations::failAfter = allocation;
+
+            try {
+                tree.emplace(key, 100);
+                inserted = true;
+            }
+            catch(const std::bad_alloc&) {
+                Allocations::failAfter = -1;
+
+                CHECK(Allocations::live == live);
+                CHECK(equals(tree, reference));
+            }
+
+            Allocations::failAfter = -1;
+        }
+
+        reference[key] = 100;
+    }
+
+    CHECK(equals(tree, reference));
+
+
+    //the nodes left by the failures would break the merges done by the removals
+    for(const auto& [key, value] : reference) tree.remove(key);
+
+    CHECK(tree.getLength() == 0 && tree.getKeys().empty());
+}
+
+
+
+
+int main() {
+    randomOperations();
+    nodeSizes();
+    failedInsertions();
+
+    return Check::result();
+}
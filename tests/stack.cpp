@@ -0,0 +1,172 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <string>
+#include <vector>
+
+
+
+
+//by default the inline elements take about a cache line whatever the type
+static_assert(sizeof(DSA::Stack<std::string>) <= 64 + 32, "A Stack<std::string> must not reserve inline room for many strings");
+static_assert(sizeof(DSA::Stack<char>) <= 64 + 32, "A Stack<char> must not reserve inline room for more than a cache line");
+
+
+//compares the elements of the stack with the reference by popping a copy, from the top to the bottom
+template<typename T, int InlineCapacity> bool equals(const DSA::Stack<T, InlineCapacity>& stack, const std::vector<T>& reference) {
+    return Fixtures::sameValues(stack.getLength(), reference.rbegin(), reference.rend(), [&stack](auto&& visit) {
+        DSA::Stack<T, InlineCapacity> copy(stack);
+
+        for(; !copy.isEmpty(); copy.pop()) visit(copy.top());
+    });
+}
+
+//applies the same random pushes and pops to the stack and to a std::vector, the stack moves between
+//its inline elements and the heap many times
+template<typename T, int InlineCapacity, typename Make> void randomOperations(unsigned seed, Make make) {
+    DSA::Stack<T, InlineCapacity> stack;
+    std::vector<T> reference;
+
+
+    Fixtures::randomSteps(seed, 20000, 1013, [&](std::mt19937& random, int step) {
+        const unsigned operation = random() % 10;
+
+        if(operation < 5 || reference.empty()) {
+            stack.push(make(step));
+            reference.push_back(make(step));
+        }
+        else if(operation < 9) {
+            stack.pop();
+            reference.pop_back();
+        }
+        else {
+            //pushing the top element must copy it before the buffer grows
+            stack.push(stack.top());
+            reference.push_back(reference.back());
+        }
+
+        if(step % 5000 == 4999) stack.clear(), reference.clear();
+    }, [&]() {
+        CHECK(equals(stack, reference));
+    });
+}
+
+//copies and moves between stacks whose elements are inline or on the heap
+void ownership() {
+    DSA::Stack<std::string, 2> small;
+    DSA::Stack<std::string, 2> large;
+
+    CHECK_THROWS(small.top());
+
+    small.push("inline");
+
+    for(int i = 0; i < 100; i++) large.emplace(std::to_string(i));
+
+
+    DSA::Stack<std::string, 2> moved(std::move(large));
+
+    CHECK(large.isEmpty());
+    CHECK(moved.getLength() == 100 && moved.top() == "99");
+
+    large = small;
+    small = std::move(moved);
+
+    CHECK(large.getLength() == 1 && large.top() == "inline");
+    CHECK(small.getLength() == 100 && small.top() == "99");
+
+
+    small.reserve(1000);
+
+    CHECK(small.getCapacity() >= 1000 && small.top() == "99");
+
+
+    DSA::Stack<int> numbers;
+
+    for(int i = 1; i <= 3; i++) numbers.push(i);
+
+    CHECK(numbers.toString() == "________\n3\n2\n1\n");
+    CHECK(numbers.toString(DSA::Modality::Direction::bottomToTop) == "________\n1\n2\n3\n");
+}
+
+//pushes and pops in batches, also from the elements of the stack itself and with copies that throw
+void bulkOperations() {
+    DSA::Stack<std::string, 2> stack;
+    std::vector<std::string> reference;
+    std::vector<std::string> values;
+
+    for(int i = 0; i < 10; i++) values.push_back(Fixtures::longString(i));
+
+    stack.pushBulk(values.data(), 10);
+    reference.insert(reference.end(), values.begin(), values.end());
+
+    CHECK(equals(stack, reference));
+
+
+    //the whole stack is pushed again, the buffer has to grow while the values are read from it
+    const std::string* bottom = &stack.top() - (stack.getLength() - 1);
+
+    stack.pushBulk(bottom, stack.getLength());
+    reference.insert(reference.end(), values.begin(), values.end());
+
+    CHECK(equals(stack, reference));
+
+
+    std::string popped[4];
+
+    CHECK(stack.popBulk(popped, 4) == 4);
+    CHECK(popped[0] == reference[16] && popped[3] == reference[19]);
+
+    reference.resize(16);
+    CHECK(equals(stack, reference));
+
+
+    DSA::Stack<int, 4> numbers;
+    const int integers[] = {1, 2, 3, 4, 5, 6};
+
+    numbers.pushBulk(integers, 3);
+    numbers.pushBulk(&numbers.top() - 2, 3);
+    numbers.pushBulk(integers + 3, 3);
+
+    CHECK(equals(numbers, std::vector<int>{1, 2, 3, 1, 2, 3, 4, 5, 6}));
+
+
+    //a copy throwing in the middle of the batch leaves the stack as it was
+    DSA::Stack<Fixtures::Fragile, 2> fragile;
+    std::vector<Fixtures::Fragile> batch(5, Fixtures::Fragile("fragile"));
+
+    fragile.push(Fixtures::Fragile("first"));
+
+    Fixtures::Fragile::copies = 3;
+    CHECK_THROWS(fragile.pushBulk(batch.data(), 5));
+    Fixtures::Fragile::copies = -1;
+
+    CHECK(equals(fragile, std::vector<Fixtures::Fragile>{Fixtures::Fragile("first")}));
+
+
+    //an assignment throwing in the middle of popBulk leaves the elements not moved yet in the stack
+    fragile.pushBulk(batch.data(), 3);
+
+    std::vector<Fixtures::Fragile> targets(4, Fixtures::Fragile(""));
+
+    Fixtures::Fragile::assignments = 2;
+    CHECK_THROWS(fragile.popBulk(targets.data(), 4));
+    Fixtures::Fragile::assignments = -1;
+
+    CHECK(equals(fragile, std::vector<Fixtures::Fragile>{Fixtures::Fragile("first"), Fixtures::Fragile("fragile")}));
+    CHECK(targets[2] == Fixtures::Fragile("fragile") && targets[3] == Fixtures::Fragile("fragile"));
+}
+
+
+
+
+int main() {
+    randomOperations<int, 1>(1, Fixtures::number);
+    randomOperations<int, 16>(2, Fixtures::number);
+    randomOperations<std::string, 2>(3, Fixtures::longString);
+
+    ownership();
+    bulkOperations();
+
+    return Check::result();
+}
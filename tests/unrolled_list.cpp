@@ -0,0 +1,178 @@
+#include "DSA.hpp"
+#include "check.hpp"
+#include "fixtures.hpp"
+
+#include <deque>
+#include <string>
+
+
+
+
+//compares the values of the list with the reference, both through indexes and iterators
+template<typename T, int ChunkCapacity> bool equals(DSA::UnrolledList<T, ChunkCapacity>& list, const std::deque<T>& reference) {
+    const auto byIndex = [&list](auto&& visit) {
+        for(int i = 0; i < list.getLength(); i++) visit(list[i]);
+    };
+
+    const auto byIterator = [&list](auto&& visit) {
+        for(auto iterator = list.begin(); iterator != list.end(); ++iterator) visit(*iterator);
+    };
+
+    return Fixtures::sameValues(list.getLength(), reference.begin(), reference.end(), byIndex) &&
+           Fixtures::sameValues(list.getLength(), reference.begin(), reference.end(), byIterator);
+}
+
+//applies the same random operations to the list and to a std::deque
+template<typename T, int ChunkCapacity, typename Make> void randomOperations(unsigned seed, Make make) {
+    DSA::UnrolledList<T, ChunkCapacity> list;
+    std::deque<T> reference;
+
+
+    Fixtures::randomSteps(seed, 4000, 97, [&](std::mt19937& random, int step) {
+        const int size = int(reference.size());
+        const int index = size ? int(random() % size) : 0;
+        const T value = make(step);
+
+        switch(random() % 8) {
+            case 0:
+                list.pushBack(value);
+                reference.push_back(value);
+                break;
+
+            case 1:
+                list.pushFront(value);
+                reference.push_front(value);
+                break;
+
+            case 2:
+                list.add(value, index);
+                reference.insert(reference.begin() + index, value);
+                break;
+
+            case 3: {
+                auto position = list.begin();
+                for(int i = 0; i < index; i++) ++position;
+
+                list.insert(position, value);
+                reference.insert(reference.begin() + index, value);
+                break;
+            }
+
+            case 4:
+                if(size == 0) break;
+
+                list.remove(index);
+                reference.erase(reference.begin() + index);
+                break;
+
+            case 5:
+                if(size == 0) break;
+
+                list.popFront();
+                reference.pop_front();
+                break;
+
+            case 6:
+                if(size == 0) break;
+
+                list.popBack();
+                reference.pop_back();
+                break;
+
+            case 7: {
+                if(size == 0) break;
+
+                auto position = list.begin();
+                for(int i = 0; i < index; i++) ++position;
+
+                list.erase(position);
+                reference.erase(reference.begin() + index);
+                break;
+            }
+        }
+
+    }, [&]() {
+        CHECK(equals(list, reference));
+    });
+}
+
+//inserting a value of the list into a full chunk must copy it before the chunk is split
+void insertAliasedValue() {
+    DSA::UnrolledList<std::string, 4> list;
+
+    for(const char* value : {"a", "b", "c", "d"}) list.add(value);
+
+
+    auto last = list.begin();
+    for(int i = 0; i < 3; i++) ++last;
+
+    list.insert(list.begin(), *last);
+
+    CHECK(list.getLength() == 5);
+    CHECK(list[0] == "d");
+    CHECK(list[4] == "d");
+
+
+    list.add(list[2], 1);
+
+    CHECK(list[1] == "b");
+}
+
+//copies, moves, swap and the checks on an empty list
+void ownership() {
+    DSA::UnrolledList<std::string, 4> list;
+
+    CHECK_THROWS(list.front());
+    CHECK_THROWS(list.back());
+    CHECK_THROWS(list[0]);
+
+    for(int i = 0; i < 10; i++) list.emplaceBack(std::to_string(i));
+
+
+    DSA::UnrolledList<std::string, 4> copy(list);
+    DSA::UnrolledList<std::string, 4> moved(std::move(list));
+
+    CHECK(list.getLength() == 0);
+    CHECK(copy.getLength() == 10 && moved.getLength() == 10);
+    CHECK(copy[5] == moved[5]);
+    CHECK(copy.front() == "0" && copy.back() == "9");
+    CHECK(copy[-1] == "9");
+
+
+    DSA::UnrolledList<std::string, 4> other;
+    other.add("x");
+    other.swap(copy);
+
+    CHECK(other.getLength() == 10 && copy.getLength() == 1);
+
+    other.clear();
+
+    CHECK(other.getLength() == 0 && other.begin() == other.end());
+
+
+    DSA::UnrolledList<int, 2> numbers;
+    for(int i = 1; i <= 3; i++) numbers.add(i);
+
+    CHECK(numbers.toString() == "[1, 2, 3]");
+    CHECK(numbers.toString(DSA::Modality::Verse::backwards) == "[3, 2, 1]");
+
+    //the indexes out of the list are clamped to its ends
+    numbers.add(9, 100);
+    numbers.add(0, -100);
+
+    CHECK(numbers.toString() == "[0, 1, 2, 3, 9]");
+}
+
+
+
+
+int main() {
+    randomOperations<int, 2>(1, Fixtures::number);
+    randomOperations<int, 16>(2, Fixtures::number);
+    randomOperations<std::string, 3>(3, Fixtures::longString);
+
+    insertAliasedValue();
+    ownership();
+
+    return Check::result();
+}